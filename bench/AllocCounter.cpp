@@ -0,0 +1,23 @@
+#include "AllocCounter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+std::atomic<uint64_t> g_count{0};
+std::atomic<uint64_t> g_bytes{0};
+} // namespace
+
+uint64_t AllocationCount() { return g_count.load(std::memory_order_relaxed); }
+uint64_t AllocatedBytes() { return g_bytes.load(std::memory_order_relaxed); }
+
+// Replaces the global allocator for the whole IgnisBench binary; the array and nothrow
+// forms forward here by default.
+void* operator new(std::size_t size) {
+    g_count.fetch_add(1, std::memory_order_relaxed);
+    g_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
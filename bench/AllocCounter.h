@@ -0,0 +1,20 @@
+#pragma once
+#include <benchmark/benchmark.h>
+#include <cstdint>
+
+// Totals from the global operator new replacement in AllocCounter.cpp.
+uint64_t AllocationCount();
+uint64_t AllocatedBytes();
+
+// Snapshots the totals on construction; report() adds allocs_per_obj and bytes_per_obj
+// (bytes requested, container regrowth included) for everything allocated since.
+struct AllocCounter {
+    uint64_t count = AllocationCount();
+    uint64_t bytes = AllocatedBytes();
+
+    void report(benchmark::State& state, int64_t objectsPerIteration) const {
+        const double objects = double(state.iterations()) * double(objectsPerIteration);
+        state.counters["allocs_per_obj"] = double(AllocationCount() - count) / objects;
+        state.counters["bytes_per_obj"] = double(AllocatedBytes() - bytes) / objects;
+    }
+};
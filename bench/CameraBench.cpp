@@ -0,0 +1,39 @@
+#include "Camera.h"
+#include <benchmark/benchmark.h>
+
+static void BM_CameraForward(benchmark::State& state) {
+    Camera cam;
+    for (auto _ : state) {
+        cam.yaw += 0.1f;
+        benchmark::DoNotOptimize(cam.forward());
+    }
+}
+BENCHMARK(BM_CameraForward);
+
+static void BM_CameraViewMatrix(benchmark::State& state) {
+    Camera cam;
+    for (auto _ : state) {
+        cam.yaw += 0.1f;
+        benchmark::DoNotOptimize(cam.viewMatrix());
+    }
+}
+BENCHMARK(BM_CameraViewMatrix);
+
+static void BM_CameraProjMatrix(benchmark::State& state) {
+    Camera cam;
+    float aspect = 16.0f / 9.0f;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(aspect);
+        benchmark::DoNotOptimize(cam.projMatrix(aspect));
+    }
+}
+BENCHMARK(BM_CameraProjMatrix);
+
+static void BM_CameraViewProj(benchmark::State& state) {
+    Camera cam;
+    for (auto _ : state) {
+        cam.yaw += 0.1f;
+        benchmark::DoNotOptimize(cam.projMatrix(16.0f / 9.0f) * cam.viewMatrix());
+    }
+}
+BENCHMARK(BM_CameraViewProj);
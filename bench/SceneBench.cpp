@@ -0,0 +1,117 @@
+#include "Scene.h"
+#include "StringPool.h"
+#include "AllocCounter.h"
+#include <benchmark/benchmark.h>
+#include <cstdio>
+
+// Every benchmark interns into its own pool, so names one leaves behind never change
+// what another measures and results do not depend on run order.
+
+static std::string_view ObjectName(char (&buf)[32], const char* prefix, int64_t i) {
+    int len = std::snprintf(buf, sizeof(buf), "%s_%lld", prefix, static_cast<long long>(i));
+    return std::string_view(buf, static_cast<size_t>(len));
+}
+
+static void BM_SceneCreate(benchmark::State& state) {
+    const auto count = state.range(0);
+    StringPool pool;
+    StringPool::Scoped usePool(pool);
+    pool.intern("GameObject");
+    AllocCounter allocs;
+    for (auto _ : state) {
+        Scene scene;
+        for (int64_t i = 0; i < count; ++i) scene.create("GameObject");
+        benchmark::DoNotOptimize(scene.objects().data());
+    }
+    allocs.report(state, count);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SceneCreate)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+static void BM_SceneIterate(benchmark::State& state) {
+    const auto count = state.range(0);
+    StringPool pool;
+    StringPool::Scoped usePool(pool);
+    Scene scene;
+    for (int64_t i = 0; i < count; ++i) scene.create("GameObject").position = glm::vec3(float(i));
+    for (auto _ : state) {
+        glm::vec3 sum{0.0f};
+        for (const auto& obj : scene.objects()) sum += obj.position * obj.scale;
+        benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SceneIterate)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// Pool cost alone: a fresh pool per iteration, every name a first intern.
+static void BM_StringPoolInternUnique(benchmark::State& state) {
+    const auto count = state.range(0);
+    char name[32];
+    size_t poolBytes = 0;
+    AllocCounter allocs;
+    for (auto _ : state) {
+        StringPool pool;
+        for (int64_t i = 0; i < count; ++i) benchmark::DoNotOptimize(pool.intern(ObjectName(name, "Unique", i)));
+        poolBytes = pool.memoryBytes();
+    }
+    allocs.report(state, count);
+    state.counters["pool_bytes_per_obj"] = double(poolBytes) / double(count);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_StringPoolInternUnique)->RangeMultiplier(8)->Range(4096, 1 << 18);
+
+// Scene cost alone: distinct names, all interned before timing, so creates take the
+// intern hit path and bytes_per_obj is the Scene's own storage.
+static void BM_SceneCreateInternedNames(benchmark::State& state) {
+    const auto count = state.range(0);
+    char name[32];
+    StringPool pool;
+    StringPool::Scoped usePool(pool);
+    for (int64_t i = 0; i < count; ++i) pool.intern(ObjectName(name, "Object", i));
+    AllocCounter allocs;
+    for (auto _ : state) {
+        Scene scene;
+        for (int64_t i = 0; i < count; ++i) scene.create(ObjectName(name, "Object", i));
+        benchmark::DoNotOptimize(scene.objects().data());
+    }
+    allocs.report(state, count);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SceneCreateInternedNames)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// Pool and Scene together: a fresh pool per iteration, so each create pays the first
+// intern. pool_bytes_per_obj is the pool's share of bytes_per_obj; the Scene's share is
+// what BM_SceneCreateInternedNames reports.
+static void BM_SceneCreateUniqueNames(benchmark::State& state) {
+    const auto count = state.range(0);
+    char name[32];
+    size_t poolBytes = 0;
+    AllocCounter allocs;
+    for (auto _ : state) {
+        StringPool pool;
+        StringPool::Scoped usePool(pool);
+        Scene scene;
+        for (int64_t i = 0; i < count; ++i) scene.create(ObjectName(name, "Unique", i));
+        benchmark::DoNotOptimize(scene.objects().data());
+        poolBytes = pool.memoryBytes();
+    }
+    allocs.report(state, count);
+    state.counters["pool_bytes_per_obj"] = double(poolBytes) / double(count);
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_SceneCreateUniqueNames)->RangeMultiplier(8)->Range(4096, 1 << 18);
+
+static void BM_SceneFindByName(benchmark::State& state) {
+    const auto count = state.range(0);
+    char name[32];
+    StringPool pool;
+    StringPool::Scoped usePool(pool);
+    Scene scene;
+    for (int64_t i = 0; i < count; ++i) scene.create(ObjectName(name, "Object", i));
+    int64_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(scene.find(ObjectName(name, "Object", i)));
+        if (++i == count) i = 0;
+    }
+}
+BENCHMARK(BM_SceneFindByName)->RangeMultiplier(8)->Range(64, 1 << 18);
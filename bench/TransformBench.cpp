@@ -0,0 +1,94 @@
+#include "Scene.h"
+#include "StringPool.h"
+#include "Camera.h"
+#include "Frustum.h"
+#include "SyntheticScene.h"
+#include "Visibility.h"
+#include <benchmark/benchmark.h>
+#include <vector>
+
+// Grid centred on the origin, so roughly half of it falls outside the default camera frustum.
+// Names go into a pool of its own so they don't outlive the benchmark.
+struct GridScene {
+    StringPool pool;
+    StringPool::Scoped usePool{pool};
+    Scene scene;
+
+    explicit GridScene(int64_t count) { PopulateGridScene(scene, static_cast<uint32_t>(count)); }
+};
+
+static void BM_ModelMatrix(benchmark::State& state) {
+    GridScene grid(state.range(0));
+    Scene& scene = grid.scene;
+    std::vector<glm::mat4> models(scene.objects().size());
+    for (auto _ : state) {
+        auto& objs = scene.objects();
+        for (size_t i = 0; i < objs.size(); ++i) models[i] = objs[i].modelMatrix();
+        benchmark::DoNotOptimize(models.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ModelMatrix)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+static void BM_ModelViewProj(benchmark::State& state) {
+    GridScene grid(state.range(0));
+    Scene& scene = grid.scene;
+    Camera cam;
+    std::vector<glm::mat4> mvps(scene.objects().size());
+    for (auto _ : state) {
+        glm::mat4 viewProj = cam.projMatrix(16.0f / 9.0f) * cam.viewMatrix();
+        auto& objs = scene.objects();
+        for (size_t i = 0; i < objs.size(); ++i) mvps[i] = viewProj * objs[i].modelMatrix();
+        benchmark::DoNotOptimize(mvps.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ModelViewProj)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+static void BM_FrustumExtract(benchmark::State& state) {
+    Camera cam;
+    for (auto _ : state) {
+        cam.yaw += 0.1f;
+        benchmark::DoNotOptimize(Frustum::fromMatrix(cam.projMatrix(16.0f / 9.0f) * cam.viewMatrix()));
+    }
+}
+BENCHMARK(BM_FrustumExtract);
+
+static void BM_FrustumCullSpheres(benchmark::State& state) {
+    GridScene grid(state.range(0));
+    Scene& scene = grid.scene;
+    Camera cam;
+    Frustum frustum = Frustum::fromMatrix(cam.projMatrix(16.0f / 9.0f) * cam.viewMatrix());
+    std::vector<uint32_t> visible;
+    visible.reserve(scene.objects().size());
+    for (auto _ : state) {
+        visible.clear();
+        auto& objs = scene.objects();
+        for (size_t i = 0; i < objs.size(); ++i) {
+            const auto& s = objs[i].scale;
+            float radius = 0.8660254f * glm::max(s.x, glm::max(s.y, s.z));
+            if (frustum.intersectsSphere(objs[i].position, radius)) visible.push_back(uint32_t(i));
+        }
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = double(visible.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_FrustumCullSpheres)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+static void BM_ComputeVisibility(benchmark::State& state) {
+    GridScene grid(state.range(0));
+    Scene& scene = grid.scene;
+    Camera cam;
+    std::vector<glm::mat4> models;
+    std::vector<uint32_t> visible;
+    for (auto _ : state) {
+        ComputeVisibility(scene.objects(), cam.projMatrix(16.0f / 9.0f) * cam.viewMatrix(), models, visible);
+        benchmark::DoNotOptimize(visible.data());
+    }
+    state.counters["visible"] = double(visible.size());
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ComputeVisibility)->RangeMultiplier(8)->Range(64, 1 << 18);
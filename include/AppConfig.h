@@ -0,0 +1,18 @@
+#pragma once
+#include <cstdint>
+#include <utility>
+#include <vector>
+#include "FrameBench.h"
+
+enum class MemoryTag : uint8_t;
+
+// Command-line options of the Ignis executable.
+struct AppConfig {
+    bool headless = false;
+    std::vector<std::pair<MemoryTag, uint64_t>> memoryBudgets;   // bytes; applied in every mode
+    BenchConfig bench;
+};
+
+// Parses --headless, repeatable --mem-budget TAG=MiB (TAG as in MemoryTagName), and the
+// bench options --bench, --objects N, --frames N, --warmup N, --out FILE. Throws on bad input.
+AppConfig ParseArgs(int argc, char** argv);
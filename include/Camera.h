@@ -31,6 +31,6 @@ public:
         glm::vec3 u = glm::normalize(glm::cross(r, f));
         return glm::mat3(r,u,f);
     }
-    void update(float dt, Input& input, bool rmbHeld);
+    void update(float dt, const Input& input, bool rmbHeld);
     static inline const glm::vec3 worldUp{0.0f, 1.0f, 0.0f};
 };
@@ -0,0 +1,53 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <glm/glm.hpp>
+
+class Scene;
+class Camera;
+class MemoryTelemetry;
+
+// Options for the scripted `--bench` run of the Ignis executable.
+// Filled by ParseArgs() (AppConfig.h).
+struct BenchConfig {
+    bool enabled = false;
+    uint32_t objects = 10000;
+    uint32_t frames = 1000;
+    uint32_t warmupFrames = 60;
+    std::string outPath;    // empty -> stdout
+};
+
+// Drives the camera along a fixed recorded path and collects per-frame timings.
+class FrameBench {
+public:
+    explicit FrameBench(const BenchConfig& config);
+
+    // Fixed simulation step so the path (and thus the rendered work) is identical across runs.
+    float frameDt() const { return 1.0f / 60.0f; }
+    void driveCamera(Camera& camera) const;
+    // CPU scene work for the frame: model matrices and frustum culling of every object
+    // (the renderer does not draw scene objects yet, so this is what scales with --objects).
+    void simulate(Scene& scene, const Camera& camera, float aspect);
+
+    // Times in milliseconds. Warmup frames are discarded.
+    void record(double frameMs, double cpuMs);
+    // GPU times arrive a frame late (read back once the frame's fence signals), so they're
+    // counted separately: the Nth call is the Nth submitted frame.
+    void recordGpu(double gpuMs);
+    bool done() const { return m_frame >= m_config.warmupFrames + m_config.frames; }
+
+    void writeReport(size_t sceneObjects, bool headless, const MemoryTelemetry& memory) const;
+
+private:
+    BenchConfig m_config;
+    uint32_t m_frame = 0;
+    uint32_t m_gpuFrame = 0;
+    std::vector<double> m_frameMs;
+    std::vector<double> m_cpuMs;
+    std::vector<double> m_gpuMs;
+    std::vector<double> m_visible;
+
+    std::vector<glm::mat4> m_models;
+    std::vector<uint32_t> m_visibleIds;
+};
@@ -0,0 +1,25 @@
+#pragma once
+#include <glm/glm.hpp>
+
+// Six clip planes (xyz = inward normal, w = distance) extracted from a view-projection matrix.
+struct Frustum {
+    glm::vec4 planes[6];
+
+    static Frustum fromMatrix(const glm::mat4& m) {
+        glm::vec4 r0(m[0][0], m[1][0], m[2][0], m[3][0]);
+        glm::vec4 r1(m[0][1], m[1][1], m[2][1], m[3][1]);
+        glm::vec4 r2(m[0][2], m[1][2], m[2][2], m[3][2]);
+        glm::vec4 r3(m[0][3], m[1][3], m[2][3], m[3][3]);
+        Frustum f;
+        f.planes[0] = r3 + r0; f.planes[1] = r3 - r0;
+        f.planes[2] = r3 + r1; f.planes[3] = r3 - r1;
+        f.planes[4] = r3 + r2; f.planes[5] = r3 - r2;
+        for (auto& p : f.planes) p /= glm::length(glm::vec3(p));
+        return f;
+    }
+    bool intersectsSphere(const glm::vec3& center, float radius) const {
+        for (const auto& p : planes)
+            if (glm::dot(glm::vec3(p), center) + p.w < -radius) return false;
+        return true;
+    }
+};
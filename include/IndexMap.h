@@ -0,0 +1,31 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Fibonacci hash of a dense id; the high bits of the product are the well-mixed ones.
+inline uint32_t HashIndex(uint32_t id) {
+    return static_cast<uint32_t>((uint64_t(id) * 0x9E3779B97F4A7C15ull) >> 32);
+}
+
+// Open-addressing uint32 -> uint32 map (linear probing, power-of-two size, erase by
+// backward shift, so no tombstones). For sparse per-object data: costs nothing until
+// the first set().
+class IndexMap {
+public:
+    static constexpr uint32_t kEmpty = ~0u;   // not a valid key; get() result when absent
+
+    uint32_t get(uint32_t key) const;
+    void set(uint32_t key, uint32_t value);
+    void erase(uint32_t key);
+    size_t size() const { return m_count; }
+
+private:
+    struct Slot { uint32_t key; uint32_t value; };
+
+    size_t probe(uint32_t key) const;
+    void grow();
+
+    std::vector<Slot> m_slots;
+    size_t m_count = 0;
+};
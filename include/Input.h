@@ -1,19 +1,86 @@
-
 #pragma once
 #include <GLFW/glfw3.h>
+#include <bitset>
+#include <cstdint>
+#include "SpscQueue.h"
+
+struct InputEvent {
+    enum class Type : uint8_t { Key, MouseButton, CursorPos, Scroll };
+    Type type{};
+    int code = 0;       // GLFW key or mouse button
+    int action = 0;     // GLFW_PRESS / GLFW_RELEASE / GLFW_REPEAT
+    int mods = 0;
+    double x = 0.0;     // cursor position or scroll offset
+    double y = 0.0;
+    double time = 0.0;  // glfwGetTime() when GLFW delivered the event
+};
 
+// Event-driven input fed by GLFW callbacks (chained to any previously installed
+// ones, e.g. ImGui's). Key/button state and mouse motion are accumulated at full
+// rate and snapshotted once per frame by beginFrame(), so presses shorter than a
+// frame are not lost. While enableEventStream(true) is in effect the same events are
+// also pushed, timestamped, into a lock-free SPSC queue that one consumer thread
+// drains with pollEvent(); with no consumer registered nothing is queued.
 class Input {
 public:
-    explicit Input(GLFWwindow* window) : m_window(window) { glfwGetCursorPos(m_window, &m_lastX, &m_lastY); }
-    void beginFrame() {
-        double x, y; glfwGetCursorPos(m_window, &x, &y);
-        m_deltaX = x - m_lastX; m_deltaY = y - m_lastY; m_lastX = x; m_lastY = y;
-    }
-    bool keyDown(int key) const { return glfwGetKey(m_window, key) == GLFW_PRESS; }
-    bool mouseDown(int btn) const { return glfwGetMouseButton(m_window, btn) == GLFW_PRESS; }
+    explicit Input(GLFWwindow* window);
+    ~Input();
+    Input(const Input&) = delete;
+    Input& operator=(const Input&) = delete;
+
+    // Main thread, after pollEvents(): publishes state accumulated since the last call.
+    void beginFrame();
+
+    // Held at snapshot time, or pressed at any point during the last frame.
+    bool keyDown(int key) const { return validKey(key) && m_keys[key]; }
+    // Went down during the last frame.
+    bool keyPressed(int key) const { return validKey(key) && m_keysPressed[key]; }
+    bool mouseDown(int btn) const { return validButton(btn) && m_buttons[btn]; }
     double mouseDeltaX() const { return m_deltaX; }
     double mouseDeltaY() const { return m_deltaY; }
+
+    // Hides/locks the cursor and switches to raw (unaccelerated) motion when supported.
+    void setCursorCaptured(bool captured);
+
+    // Main thread, while no consumer is polling. Enabling starts from an empty queue so a
+    // new consumer never sees events from before it registered.
+    void enableEventStream(bool enabled);
+    bool eventStreamEnabled() const { return m_streamEvents; }
+
+    // Consumer side of the event stream; callable from one thread other than the producer.
+    bool pollEvent(InputEvent& out) { return m_events.pop(out); }
+    uint64_t droppedEvents() const { return m_events.dropped(); }
+
 private:
+    using KeyBits = std::bitset<GLFW_KEY_LAST + 1>;
+    using ButtonBits = std::bitset<GLFW_MOUSE_BUTTON_LAST + 1>;
+
+    static bool validKey(int key) { return key >= 0 && key <= GLFW_KEY_LAST; }
+    static bool validButton(int btn) { return btn >= 0 && btn <= GLFW_MOUSE_BUTTON_LAST; }
+    static Input* from(GLFWwindow* window) { return static_cast<Input*>(glfwGetWindowUserPointer(window)); }
+
+    static void keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods);
+    static void mouseButtonCallback(GLFWwindow* window, int button, int action, int mods);
+    static void cursorPosCallback(GLFWwindow* window, double x, double y);
+    static void scrollCallback(GLFWwindow* window, double dx, double dy);
+
     GLFWwindow* m_window{};
-    double m_lastX{0.0}, m_lastY{0.0}, m_deltaX{0.0}, m_deltaY{0.0};
+    GLFWkeyfun m_prevKey{};
+    GLFWmousebuttonfun m_prevMouseButton{};
+    GLFWcursorposfun m_prevCursorPos{};
+    GLFWscrollfun m_prevScroll{};
+
+    // Written by callbacks, consumed by beginFrame(); both on the main thread.
+    KeyBits m_keysLive, m_keysLatched, m_keysPressedLive;
+    ButtonBits m_buttonsLive, m_buttonsLatched;
+    double m_lastX{0.0}, m_lastY{0.0}, m_accumX{0.0}, m_accumY{0.0};
+    bool m_captured = false;
+
+    // Per-frame snapshot.
+    KeyBits m_keys, m_keysPressed;
+    ButtonBits m_buttons;
+    double m_deltaX{0.0}, m_deltaY{0.0};
+
+    bool m_streamEvents = false;
+    SpscQueue<InputEvent, 1024> m_events;
 };
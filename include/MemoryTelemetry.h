@@ -0,0 +1,84 @@
+#pragma once
+#include <vulkan/vulkan.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+typedef struct VmaAllocator_T* VmaAllocator;
+
+// Subsystems that get their own VkAllocationCallbacks and host-memory counters.
+enum class MemoryTag : uint8_t { Core, Swapchain, Frame, ImGui, Vma, Count };
+constexpr size_t kMemoryTagCount = static_cast<size_t>(MemoryTag::Count);
+const char* MemoryTagName(MemoryTag tag);
+bool MemoryTagFromName(std::string_view name, MemoryTag& out);
+
+// Process-wide resident set size (0 where unsupported).
+uint64_t CurrentResidentBytes();
+uint64_t PeakResidentBytes();
+
+// Host memory the Vulkan driver allocates through per-tag callbacks, plus device heap
+// usage/budget from VMA (backed by VK_EXT_memory_budget when the device has it).
+// Tags can be given budgets; crossing one logs a warning once until usage drops again.
+class MemoryTelemetry {
+public:
+    struct HostStats {
+        uint64_t bytes = 0;
+        uint64_t peakBytes = 0;
+        uint64_t allocations = 0;   // live allocations
+        uint64_t budget = 0;        // 0 = unlimited
+        bool overBudget = false;
+        bool everOverBudget = false;
+    };
+    struct HeapStats {
+        VkDeviceSize size = 0;
+        VkDeviceSize usage = 0;     // whole process, from the driver when VK_EXT_memory_budget is on
+        VkDeviceSize budget = 0;
+        VkDeviceSize blockBytes = 0;        // VMA-owned VkDeviceMemory
+        VkDeviceSize allocationBytes = 0;   // VMA sub-allocations handed out
+        uint32_t blockCount = 0;
+        uint32_t allocationCount = 0;
+        bool deviceLocal = false;
+        bool warned = false;
+    };
+
+    MemoryTelemetry();
+    MemoryTelemetry(const MemoryTelemetry&) = delete;
+    MemoryTelemetry& operator=(const MemoryTelemetry&) = delete;
+
+    const VkAllocationCallbacks* callbacks(MemoryTag tag) const { return &m_callbacks[static_cast<size_t>(tag)]; }
+
+    void setBudget(MemoryTag tag, uint64_t bytes) { m_counters[static_cast<size_t>(tag)].budget = bytes; }
+    HostStats host(MemoryTag tag) const;
+
+    // Once per frame: refreshes heap stats and checks budgets.
+    void update(VmaAllocator allocator);
+    const std::vector<HeapStats>& heaps() const { return m_heaps; }
+
+private:
+    struct Counters {
+        std::atomic<uint64_t> bytes{0};
+        std::atomic<uint64_t> peak{0};
+        std::atomic<uint64_t> allocations{0};
+        uint64_t budget = 0;
+        bool overBudget = false;
+        bool everOverBudget = false;
+    };
+
+    static void add(Counters& c, size_t size);
+    static void sub(Counters& c, size_t size);
+
+    static VKAPI_ATTR void* VKAPI_CALL allocate(void* user, size_t size, size_t alignment, VkSystemAllocationScope scope);
+    static VKAPI_ATTR void* VKAPI_CALL reallocate(void* user, void* original, size_t size, size_t alignment,
+                                                  VkSystemAllocationScope scope);
+    static VKAPI_ATTR void VKAPI_CALL release(void* user, void* memory);
+    static VKAPI_ATTR void VKAPI_CALL internalAlloc(void* user, size_t size, VkInternalAllocationType type,
+                                                    VkSystemAllocationScope scope);
+    static VKAPI_ATTR void VKAPI_CALL internalFree(void* user, size_t size, VkInternalAllocationType type,
+                                                   VkSystemAllocationScope scope);
+
+    std::array<Counters, kMemoryTagCount> m_counters;
+    std::array<VkAllocationCallbacks, kMemoryTagCount> m_callbacks{};
+    std::vector<HeapStats> m_heaps;
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// Case-insensitive trigram index over object names for substring search. Names shorter
+// than three chars are keyed by the whole name. Updated incrementally on add/remove, so a
+// query costs O(matches) instead of a scan; 1-2 char queries union every key containing them.
+class NameIndex {
+public:
+    using NameLookup = std::function<std::string_view(uint32_t)>;
+
+    void add(uint32_t id, std::string_view name);
+    void remove(uint32_t id, std::string_view name);
+    void clear() { m_postings.clear(); }
+
+    // Writes ids whose name contains `query` (case-insensitive) to `out`, ascending.
+    // `nameOf` is used to reject n-gram false positives.
+    void search(std::string_view query, const NameLookup& nameOf, std::vector<uint32_t>& out) const;
+
+private:
+    static void collectGrams(std::string_view name, std::vector<uint32_t>& grams);
+
+    std::unordered_map<uint32_t, std::vector<uint32_t>> m_postings;   // gram -> sorted ids
+};
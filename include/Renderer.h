@@ -2,12 +2,13 @@
 #pragma once
 #include <vulkan/vulkan.h>
 #include <vector>
+#include "MemoryTelemetry.h"
 
 class Window;
 
 class Renderer {
 public:
-    Renderer(Window& window);
+    Renderer(Window& window, bool vsync = true);
     ~Renderer();
 
     void beginFrame();
@@ -26,11 +27,24 @@ public:
 
     VkDescriptorPool imguiDescriptorPool() const { return m_imguiDescriptorPool; }
     VkCommandPool commandPool() const { return m_commandPool; }
+    VmaAllocator allocator() const { return m_allocator; }
+    MemoryTelemetry& memory() { return m_memory; }
+    const MemoryTelemetry& memory() const { return m_memory; }
+
+    // GPU time of the most recently completed frame. Results land in beginFrame() of the
+    // following frame (or waitIdle() for the last one); returns true once per new result.
+    bool takeGpuFrameMs(double& ms) {
+        if (!m_gpuFrameReady) return false;
+        m_gpuFrameReady = false;
+        ms = m_gpuFrameMs;
+        return true;
+    }
 
 private:
     void createInstance();
     void pickPhysicalDevice();
     void createDevice();
+    void createAllocator();
     void createSurface();
     void createSwapchain();
     void createImageViews();
@@ -40,6 +54,8 @@ private:
     void createCommandBuffers();
     void createSyncObjects();
     void createImguiDescriptorPool();
+    void createTimestampQueries();
+    void readTimestampQueries();
 
     VkSurfaceFormatKHR chooseSurfaceFormat(const std::vector<VkSurfaceFormatKHR>&);
     VkPresentModeKHR choosePresentMode(const std::vector<VkPresentModeKHR>&);
@@ -47,10 +63,13 @@ private:
 
 private:
     Window& m_window;
+    MemoryTelemetry m_memory;   // must outlive every object created with its callbacks
     VkInstance m_instance{};
     VkSurfaceKHR m_surface{};
     VkPhysicalDevice m_physicalDevice{};
     VkDevice m_device{};
+    VmaAllocator m_allocator{};
+    bool m_memoryBudgetExt = false;
     uint32_t m_graphicsFamily{};
     VkQueue m_graphicsQueue{};
     VkSwapchainKHR m_swapchain{};
@@ -68,4 +87,12 @@ private:
     VkDescriptorPool m_imguiDescriptorPool{};
     uint32_t m_currentImage = 0;
     bool m_frameBegun = false;
+    bool m_vsync = true;
+
+    VkQueryPool m_timestampPool{};
+    uint32_t m_timestampValidBits = 0;
+    float m_timestampPeriod = 0.0f;
+    bool m_timestampsPending = false;
+    double m_gpuFrameMs = 0.0;
+    bool m_gpuFrameReady = false;
 };
@@ -1,21 +1,57 @@
-
 #pragma once
 #include <vector>
-#include <string>
+#include <string_view>
 #include <glm/glm.hpp>
+#include "IndexMap.h"
+#include "NameIndex.h"
+#include "StringPool.h"
 
 struct GameObject {
-    std::string name;
+    NameId name = StringPool::kEmpty;   // interned in StringPool::global()
     glm::vec3 position{0.0f};
     glm::vec3 rotation{0.0f};
     glm::vec3 scale{1.0f};
+
+    std::string_view nameView() const { return StringPool::global().view(name); }
+    const char* nameCStr() const { return StringPool::global().c_str(name); }
+    glm::mat4 modelMatrix() const;
 };
 
 class Scene {
 public:
-    GameObject& create(const std::string& name);
+    static constexpr uint32_t kNone = ~0u;
+
+    GameObject& create(std::string_view name);
+    // Renames through the scene so the name indices stay in sync; don't assign GameObject::name directly.
+    // Each distinct new name stays in the (append-only) StringPool, so call this on commit, not per keystroke.
+    void rename(uint32_t index, std::string_view name);
     std::vector<GameObject>& objects() { return m_objects; }
 
+    // O(1) lookup: first-created object with this name, or kNone. Walk duplicates with nextWithSameName().
+    uint32_t find(std::string_view name) const;
+    uint32_t nextWithSameName(uint32_t index) const;
+
+    const NameIndex& nameIndex() const { return m_nameIndex; }
+    // Incremented on every create/rename; lets UI caches know when to requery.
+    uint64_t revision() const { return m_revision; }
+
 private:
+    static constexpr uint32_t kShared = 1u << 31;   // name slot flag: other objects have this name too
+
+    void link(uint32_t index);
+    void unlink(uint32_t index);
+    size_t nameSlot(NameId name) const;
+    void growNames();
+
     std::vector<GameObject> m_objects;
+    // Open addressing over NameId, sized by this scene's distinct names. A slot holds the
+    // newest object with the name (kShared if there are others) and the key is read from
+    // that object; kNone = empty.
+    std::vector<uint32_t> m_names;
+    size_t m_nameCount = 0;
+    // Objects sharing a name form a list in ascending index order whose newest entry links
+    // back to the oldest. Only shared names have entries; unique names cost nothing here.
+    IndexMap m_sameName;
+    NameIndex m_nameIndex;
+    uint64_t m_revision = 0;
 };
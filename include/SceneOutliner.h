@@ -0,0 +1,36 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+
+class Scene;
+
+// "Scene" window: virtualized object table with indexed name filter and multi-select bulk edits.
+// Per-frame cost scales with visible rows and selection size, not with scene size.
+class SceneOutliner {
+public:
+    void draw(Scene& scene);
+
+private:
+    void refreshFilter(Scene& scene);
+    bool isSelected(uint32_t id) const { return id < m_selectedFlags.size() && m_selectedFlags[id]; }
+    void select(uint32_t id);
+    void deselect(uint32_t id);
+    void clearSelection();
+    void handleClick(Scene& scene, uint32_t id, int row);
+    uint32_t rowToId(int row) const { return m_filtering ? m_matches[row] : static_cast<uint32_t>(row); }
+
+    char m_newName[128] = "NewObject";
+    char m_filter[128] = "";
+    char m_rename[128] = "";
+
+    // Cached filter result, requeried only when the text or scene revision changes.
+    bool m_filtering = false;
+    std::string m_lastFilter;
+    uint64_t m_lastRevision = ~0ull;
+    std::vector<uint32_t> m_matches;
+
+    std::vector<uint8_t> m_selectedFlags;   // by object index, for O(1) tests
+    std::vector<uint32_t> m_selection;      // selected object indices, for O(selected) bulk edits
+    int m_anchorRow = -1;                   // shift-click range anchor (row in current view)
+};
@@ -0,0 +1,74 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+// (arena block << 16) | offset of the string's record in that block.
+using NameId = uint32_t;
+
+// Append-only string interning pool. Strings are copied once into arena blocks that
+// never move, so ids, views and c_str() pointers stay valid for the life of the pool.
+// An id is the string's arena position, so the pool keeps no per-string entry table.
+// Not thread-safe: intern from the main thread.
+class StringPool {
+public:
+    static constexpr NameId kEmpty = 0;          // id of ""
+    static constexpr NameId kInvalid = ~0u;
+
+    // The process-wide pool, or the one a live Scoped has installed.
+    static StringPool& global();
+
+    // Redirects global() to `pool` until destroyed, e.g. so a benchmark interns into a
+    // pool it throws away. Scenes that use it must not outlive it.
+    class Scoped {
+    public:
+        explicit Scoped(StringPool& pool);
+        ~Scoped();
+        Scoped(const Scoped&) = delete;
+        Scoped& operator=(const Scoped&) = delete;
+    private:
+        StringPool* m_previous;
+    };
+
+    StringPool();
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    NameId intern(std::string_view s);
+    NameId find(std::string_view s) const;       // kInvalid if never interned
+    std::string_view view(NameId id) const;
+    const char* c_str(NameId id) const { return view(id).data(); }
+
+    size_t count() const { return m_count; }
+    size_t arenaBytes() const { return m_arenaBytes; }
+    // Arena plus lookup table.
+    size_t memoryBytes() const { return m_arenaBytes + m_slots.capacity() * sizeof(NameId); }
+
+private:
+    NameId store(std::string_view s);
+    size_t probe(std::string_view s, uint32_t hash) const;
+    void grow();
+    static constexpr size_t kBlockSize = 64 * 1024;          // offsets fit the id's low 16 bits
+    static constexpr size_t kLargeString = kBlockSize / 8;   // longer strings get their own block
+    static constexpr size_t kMaxBlocks = 0xFFFF;             // keeps kInvalid unreachable
+
+    // Records are a length (1 byte, or 0xFF plus 4 bytes) followed by the chars and a '\0'.
+    // No hash is cached: that would cost 4 bytes a name, more than interning saves on a
+    // short name, so probes compare lengths then chars and grow() rehashes from the arena.
+    std::vector<std::unique_ptr<char[]>> m_blocks;
+    std::vector<NameId> m_slots;   // open addressing, linear probing, power-of-two size; kInvalid = empty
+    size_t m_count = 0;
+    size_t m_cursorBlock = 0;
+    size_t m_cursor = kBlockSize;   // offset into m_cursorBlock; full until the first block exists
+    size_t m_arenaBytes = 0;
+};
+
+inline std::string_view StringPool::view(NameId id) const {
+    const char* r = m_blocks[id >> 16].get() + (id & 0xFFFF);
+    uint32_t size = static_cast<unsigned char>(r[0]);
+    if (size < 0xFF) return {r + 1, size};
+    std::memcpy(&size, r + 1, sizeof(size));
+    return {r + 5, size};
+}
@@ -0,0 +1,11 @@
+#pragma once
+#include <cstdint>
+
+class Scene;
+
+// Edge length of the smallest cube grid holding `count` objects.
+uint32_t GridSide(uint32_t count);
+
+// Fills the scene with `count` objects named Object_<i> on a cube grid (2 units apart)
+// centred on the origin. Deterministic; shared by `Ignis --bench` and IgnisBench.
+void PopulateGridScene(Scene& scene, uint32_t count);
@@ -0,0 +1,12 @@
+#pragma once
+#include <cstdint>
+#include <vector>
+#include <glm/glm.hpp>
+
+struct GameObject;
+
+// Per-frame CPU scene pass: writes every object's model matrix to `models` and the indices
+// of objects whose bounding sphere (unit cube scaled by GameObject::scale) intersects the
+// view frustum to `visible`, ascending.
+void ComputeVisibility(const std::vector<GameObject>& objects, const glm::mat4& viewProj,
+                       std::vector<glm::mat4>& models, std::vector<uint32_t>& visible);
@@ -6,7 +6,8 @@ struct GLFWwindow;
 
 class Window {
 public:
-    Window(int width, int height, const std::string& title);
+    // headless: use GLFW's null platform (no display needed; surface via VK_EXT_headless_surface).
+    Window(int width, int height, const std::string& title, bool headless = false);
     ~Window();
 
     GLFWwindow* handle() const { return m_window; }
@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Compare two IgnisBench result files and flag regressions.
+
+Usage:
+    IgnisBench --benchmark_out=base.json --benchmark_out_format=json
+    IgnisBench --benchmark_out=new.json  --benchmark_out_format=json
+    scripts/compare_bench.py base.json new.json [--threshold 0.10]
+
+Both Google Benchmark JSON and CSV outputs are accepted. Exits with status 1
+if any benchmark got slower than the threshold (relative, default 10%).
+"""
+import argparse
+import csv
+import json
+import sys
+
+
+def load(path):
+    """Return {name: cpu_time_ns} for every non-aggregate benchmark row."""
+    to_ns = {"ns": 1.0, "us": 1e3, "ms": 1e6, "s": 1e9}
+    rows = []
+    with open(path, newline="") as f:
+        if path.endswith(".json"):
+            rows = json.load(f).get("benchmarks", [])
+        else:
+            # CSV output is preceded by a free-form context header.
+            lines = f.read().splitlines()
+            start = next(i for i, l in enumerate(lines) if l.startswith("name,"))
+            rows = list(csv.DictReader(lines[start:]))
+    results = {}
+    for r in rows:
+        if r.get("run_type") == "aggregate" or r.get("error_occurred") in (True, "true"):
+            continue
+        unit = r.get("time_unit") or "ns"
+        results[r["name"]] = float(r["cpu_time"]) * to_ns[unit]
+    return results
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    ap.add_argument("baseline")
+    ap.add_argument("contender")
+    ap.add_argument("--threshold", type=float, default=0.10,
+                    help="relative slowdown that counts as a regression (default: 0.10)")
+    args = ap.parse_args()
+
+    base = load(args.baseline)
+    new = load(args.contender)
+
+    regressions = 0
+    width = max((len(n) for n in base), default=4)
+    print(f"{'name':<{width}}  {'base ns':>12}  {'new ns':>12}  {'delta':>8}")
+    for name, b in base.items():
+        if name not in new:
+            print(f"{name:<{width}}  {b:>12.1f}  {'missing':>12}")
+            continue
+        n = new[name]
+        delta = (n - b) / b if b > 0 else 0.0
+        flag = ""
+        if delta > args.threshold:
+            flag = "  REGRESSION"
+            regressions += 1
+        print(f"{name:<{width}}  {b:>12.1f}  {n:>12.1f}  {delta:>+8.1%}{flag}")
+    for name in new.keys() - base.keys():
+        print(f"{name:<{width}}  {'new':>12}  {new[name]:>12.1f}")
+
+    if regressions:
+        print(f"\n{regressions} benchmark(s) regressed by more than {args.threshold:.0%}")
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,54 @@
+#include "AppConfig.h"
+#include "MemoryTelemetry.h"
+
+#include <cctype>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+uint32_t ParseCount(const std::string& flag, const char* value) {
+    try {
+        // stoull skips whitespace and wraps a leading '-', so insist on a digit first.
+        if (!std::isdigit(static_cast<unsigned char>(value[0]))) throw std::invalid_argument(value);
+        size_t used = 0;
+        unsigned long long v = std::stoull(value, &used);
+        if (value[used] != '\0' || v > UINT32_MAX) throw std::out_of_range(value);
+        return static_cast<uint32_t>(v);
+    } catch (const std::exception&) {
+        throw std::runtime_error("Invalid value for " + flag + ": " + value);
+    }
+}
+
+} // namespace
+
+AppConfig ParseArgs(int argc, char** argv) {
+    AppConfig cfg;
+    BenchConfig& bench = cfg.bench;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&]() -> const char* {
+            if (i + 1 >= argc) throw std::runtime_error("Missing value for " + arg);
+            return argv[++i];
+        };
+        if (arg == "--headless") cfg.headless = true;
+        else if (arg == "--mem-budget") {
+            std::string value = next();
+            size_t eq = value.find('=');
+            MemoryTag tag{};
+            if (eq == std::string::npos || !MemoryTagFromName(std::string_view(value).substr(0, eq), tag))
+                throw std::runtime_error("Invalid --mem-budget (expected TAG=MiB): " + value);
+            uint64_t mib = ParseCount(arg, value.c_str() + eq + 1);
+            cfg.memoryBudgets.emplace_back(tag, mib * 1024 * 1024);
+        }
+        else if (arg == "--bench") bench.enabled = true;
+        else if (arg == "--objects") bench.objects = ParseCount(arg, next());
+        else if (arg == "--frames") bench.frames = ParseCount(arg, next());
+        else if (arg == "--warmup") bench.warmupFrames = ParseCount(arg, next());
+        else if (arg == "--out") bench.outPath = next();
+        else throw std::runtime_error("Unknown argument: " + arg);
+    }
+    if (bench.enabled && bench.frames == 0) throw std::runtime_error("--frames must be > 0");
+    return cfg;
+}
@@ -3,7 +3,7 @@
 #include "Input.h"
 #include <GLFW/glfw3.h>
 #include <algorithm>
-void Camera::update(float dt, Input& input, bool rmbHeld) {
+void Camera::update(float dt, const Input& input, bool rmbHeld) {
     glm::vec3 f = forward();
     glm::vec3 r = glm::normalize(glm::cross(f, worldUp));
     glm::vec3 u = worldUp;
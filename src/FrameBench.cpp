@@ -0,0 +1,142 @@
+#include "FrameBench.h"
+#include "Scene.h"
+#include "Camera.h"
+#include "MemoryTelemetry.h"
+#include "SyntheticScene.h"
+#include "Visibility.h"
+
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <iostream>
+#include <numeric>
+#include <stdexcept>
+
+namespace {
+
+struct PathKey { float time; glm::vec3 pos; float yaw; float pitch; };
+
+// Recorded fly-through, positions in units of the synthetic scene's half extent.
+// Loops every 16 s of simulated time.
+const PathKey kPath[] = {
+    {  0.0f, { 0.0f,  0.2f,  1.6f}, -90.0f,   0.0f },
+    {  4.0f, { 1.2f,  0.5f,  0.8f}, -150.0f, -15.0f },
+    {  8.0f, { 0.0f,  0.1f, -0.3f}, -270.0f,  10.0f },
+    { 12.0f, {-1.4f, -0.4f,  0.6f}, -330.0f,  20.0f },
+    { 16.0f, { 0.0f,  0.2f,  1.6f}, -450.0f,   0.0f },
+};
+
+struct Summary { double p50 = 0, p95 = 0, p99 = 0, mean = 0, max = 0; };
+
+Summary Summarize(std::vector<double> samples) {
+    Summary s;
+    if (samples.empty()) return s;
+    std::sort(samples.begin(), samples.end());
+    auto pct = [&](double p) {
+        size_t rank = static_cast<size_t>(std::ceil(p * samples.size()));
+        return samples[std::clamp<size_t>(rank, 1, samples.size()) - 1];
+    };
+    s.p50 = pct(0.50); s.p95 = pct(0.95); s.p99 = pct(0.99);
+    s.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / samples.size();
+    s.max = samples.back();
+    return s;
+}
+
+void WriteSummary(std::ostream& os, const char* key, const Summary& s) {
+    os << "  \"" << key << "\": { \"p50\": " << s.p50 << ", \"p95\": " << s.p95 << ", \"p99\": " << s.p99
+       << ", \"mean\": " << s.mean << ", \"max\": " << s.max << " },\n";
+}
+
+void WriteMemory(std::ostream& os, const MemoryTelemetry& memory) {
+    os << "  \"memory\": {\n";
+    os << "    \"rss_bytes\": " << CurrentResidentBytes() << ",\n";
+    os << "    \"host\": {\n";
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        auto tag = static_cast<MemoryTag>(i);
+        auto s = memory.host(tag);
+        os << "      \"" << MemoryTagName(tag) << "\": { \"bytes\": " << s.bytes << ", \"peak_bytes\": " << s.peakBytes
+           << ", \"allocations\": " << s.allocations << ", \"budget_bytes\": " << s.budget
+           << ", \"over_budget\": " << (s.everOverBudget ? "true" : "false") << " }"
+           << (i + 1 < kMemoryTagCount ? ",\n" : "\n");
+    }
+    os << "    },\n";
+    os << "    \"heaps\": [\n";
+    const auto& heaps = memory.heaps();
+    for (size_t h = 0; h < heaps.size(); ++h) {
+        const auto& heap = heaps[h];
+        os << "      { \"size\": " << heap.size << ", \"device_local\": " << (heap.deviceLocal ? "true" : "false")
+           << ", \"usage\": " << heap.usage << ", \"budget\": " << heap.budget
+           << ", \"vma_block_bytes\": " << heap.blockBytes << ", \"vma_allocation_bytes\": " << heap.allocationBytes
+           << " }" << (h + 1 < heaps.size() ? ",\n" : "\n");
+    }
+    os << "    ]\n";
+    os << "  },\n";
+}
+
+} // namespace
+
+FrameBench::FrameBench(const BenchConfig& config) : m_config(config) {
+    m_frameMs.reserve(config.frames);
+    m_cpuMs.reserve(config.frames);
+    m_gpuMs.reserve(config.frames);
+    m_visible.reserve(config.frames);
+}
+
+void FrameBench::driveCamera(Camera& camera) const {
+    constexpr size_t keyCount = sizeof(kPath) / sizeof(kPath[0]);
+    const float loop = kPath[keyCount - 1].time;
+    const float t = std::fmod(float(m_frame) * frameDt(), loop);
+    size_t k = 0;
+    while (k + 2 < keyCount && kPath[k + 1].time <= t) ++k;
+    const PathKey& a = kPath[k];
+    const PathKey& b = kPath[k + 1];
+    float u = (t - a.time) / (b.time - a.time);
+    u = u * u * (3.0f - 2.0f * u);
+    const float extent = float(GridSide(std::max(m_config.objects, 1u))) + 2.0f;
+    camera.position = glm::mix(a.pos, b.pos, u) * extent;
+    camera.yaw = glm::mix(a.yaw, b.yaw, u);
+    camera.pitch = glm::mix(a.pitch, b.pitch, u);
+}
+
+void FrameBench::simulate(Scene& scene, const Camera& camera, float aspect) {
+    ComputeVisibility(scene.objects(), camera.projMatrix(aspect) * camera.viewMatrix(), m_models, m_visibleIds);
+}
+
+void FrameBench::record(double frameMs, double cpuMs) {
+    if (m_frame++ < m_config.warmupFrames) return;
+    m_frameMs.push_back(frameMs);
+    m_cpuMs.push_back(cpuMs);
+    m_visible.push_back(double(m_visibleIds.size()));
+}
+
+void FrameBench::recordGpu(double gpuMs) {
+    const uint32_t frame = m_gpuFrame++;
+    if (frame < m_config.warmupFrames || frame >= m_config.warmupFrames + m_config.frames) return;
+    m_gpuMs.push_back(gpuMs);
+}
+
+void FrameBench::writeReport(size_t sceneObjects, bool headless, const MemoryTelemetry& memory) const {
+    std::ofstream file;
+    if (!m_config.outPath.empty()) {
+        file.open(m_config.outPath);
+        if (!file) throw std::runtime_error("Failed to open bench output: " + m_config.outPath);
+    }
+    std::ostream& os = file.is_open() ? static_cast<std::ostream&>(file) : std::cout;
+    os.setf(std::ios::fixed);
+    os.precision(4);
+    os << "{\n";
+    os << "  \"objects\": " << sceneObjects << ",\n";
+    os << "  \"frames\": " << m_frameMs.size() << ",\n";
+    os << "  \"gpu_frames\": " << m_gpuMs.size() << ",\n";
+    os << "  \"warmup_frames\": " << m_config.warmupFrames << ",\n";
+    os << "  \"headless\": " << (headless ? "true" : "false") << ",\n";
+    WriteSummary(os, "frame_ms", Summarize(m_frameMs));
+    WriteSummary(os, "cpu_ms", Summarize(m_cpuMs));
+    WriteSummary(os, "gpu_ms", Summarize(m_gpuMs));
+    WriteSummary(os, "visible_objects", Summarize(m_visible));
+    WriteMemory(os, memory);
+    os << "  \"peak_rss_bytes\": " << PeakResidentBytes() << "\n";
+    os << "}\n";
+    if (file.is_open()) spdlog::info("Bench report written to {}", m_config.outPath);
+}
@@ -29,6 +29,7 @@ ImGuiLayer::ImGuiLayer(Window& window, Renderer& renderer)
     init_info.MinImageCount = 2;
     init_info.ImageCount = 3;
     init_info.MSAASamples = VK_SAMPLE_COUNT_1_BIT;
+    init_info.Allocator = renderer.memory().callbacks(MemoryTag::ImGui);
     ImGui_ImplVulkan_Init(&init_info, renderer.renderPass());
 
     // Upload fonts
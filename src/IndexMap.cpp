@@ -0,0 +1,52 @@
+#include "IndexMap.h"
+
+// Slot holding `key`, or the empty slot where it would go. Requires a non-empty table.
+size_t IndexMap::probe(uint32_t key) const {
+    const size_t mask = m_slots.size() - 1;
+    size_t i = HashIndex(key) & mask;
+    while (m_slots[i].key != kEmpty && m_slots[i].key != key) i = (i + 1) & mask;
+    return i;
+}
+
+uint32_t IndexMap::get(uint32_t key) const {
+    if (m_slots.empty()) return kEmpty;
+    const Slot& slot = m_slots[probe(key)];
+    return slot.key == kEmpty ? kEmpty : slot.value;
+}
+
+void IndexMap::set(uint32_t key, uint32_t value) {
+    if ((m_count + 1) * 10 > m_slots.size() * 7) grow();
+    Slot& slot = m_slots[probe(key)];
+    if (slot.key == kEmpty) ++m_count;
+    slot = {key, value};
+}
+
+void IndexMap::erase(uint32_t key) {
+    if (m_slots.empty()) return;
+    const size_t mask = m_slots.size() - 1;
+    size_t hole = probe(key);
+    if (m_slots[hole].key == kEmpty) return;
+    --m_count;
+    // Pull later entries of the probe run back into the hole unless that would move
+    // one in front of its home slot.
+    for (size_t j = (hole + 1) & mask; m_slots[j].key != kEmpty; j = (j + 1) & mask) {
+        const size_t home = HashIndex(m_slots[j].key) & mask;
+        if (((j - home) & mask) >= ((j - hole) & mask)) {
+            m_slots[hole] = m_slots[j];
+            hole = j;
+        }
+    }
+    m_slots[hole].key = kEmpty;
+}
+
+void IndexMap::grow() {
+    std::vector<Slot> old(m_slots.empty() ? 16 : m_slots.size() * 2, Slot{kEmpty, 0});
+    old.swap(m_slots);
+    const size_t mask = m_slots.size() - 1;
+    for (const Slot& slot : old) {
+        if (slot.key == kEmpty) continue;
+        size_t i = HashIndex(slot.key) & mask;
+        while (m_slots[i].key != kEmpty) i = (i + 1) & mask;
+        m_slots[i] = slot;
+    }
+}
@@ -1 +1,89 @@
 #include "Input.h"
+
+Input::Input(GLFWwindow* window) : m_window(window) {
+    glfwGetCursorPos(m_window, &m_lastX, &m_lastY);
+    glfwSetWindowUserPointer(m_window, this);
+    m_prevKey = glfwSetKeyCallback(m_window, keyCallback);
+    m_prevMouseButton = glfwSetMouseButtonCallback(m_window, mouseButtonCallback);
+    m_prevCursorPos = glfwSetCursorPosCallback(m_window, cursorPosCallback);
+    m_prevScroll = glfwSetScrollCallback(m_window, scrollCallback);
+}
+
+Input::~Input() {
+    glfwSetKeyCallback(m_window, m_prevKey);
+    glfwSetMouseButtonCallback(m_window, m_prevMouseButton);
+    glfwSetCursorPosCallback(m_window, m_prevCursorPos);
+    glfwSetScrollCallback(m_window, m_prevScroll);
+    glfwSetWindowUserPointer(m_window, nullptr);
+}
+
+void Input::beginFrame() {
+    m_keys = m_keysLive | m_keysLatched;
+    m_keysPressed = m_keysPressedLive;
+    m_buttons = m_buttonsLive | m_buttonsLatched;
+    m_keysLatched.reset();
+    m_keysPressedLive.reset();
+    m_buttonsLatched.reset();
+
+    m_deltaX = m_accumX; m_deltaY = m_accumY;
+    m_accumX = m_accumY = 0.0;
+}
+
+void Input::setCursorCaptured(bool captured) {
+    if (captured == m_captured) return;
+    m_captured = captured;
+    glfwSetInputMode(m_window, GLFW_CURSOR, captured ? GLFW_CURSOR_DISABLED : GLFW_CURSOR_NORMAL);
+    if (glfwRawMouseMotionSupported())
+        glfwSetInputMode(m_window, GLFW_RAW_MOUSE_MOTION, captured ? GLFW_TRUE : GLFW_FALSE);
+    // Switching modes can warp the cursor; resync so it doesn't show up as motion.
+    glfwGetCursorPos(m_window, &m_lastX, &m_lastY);
+}
+
+void Input::enableEventStream(bool enabled) {
+    if (enabled && !m_streamEvents) m_events.reset();
+    m_streamEvents = enabled;
+}
+
+void Input::keyCallback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    Input* self = from(window);
+    if (self->m_prevKey) self->m_prevKey(window, key, scancode, action, mods);
+    if (validKey(key)) {
+        if (action == GLFW_PRESS) {
+            self->m_keysLive.set(key);
+            self->m_keysLatched.set(key);
+            self->m_keysPressedLive.set(key);
+        } else if (action == GLFW_RELEASE) {
+            self->m_keysLive.reset(key);
+        }
+    }
+    if (self->m_streamEvents) self->m_events.push({InputEvent::Type::Key, key, action, mods, 0.0, 0.0, glfwGetTime()});
+}
+
+void Input::mouseButtonCallback(GLFWwindow* window, int button, int action, int mods) {
+    Input* self = from(window);
+    if (self->m_prevMouseButton) self->m_prevMouseButton(window, button, action, mods);
+    if (validButton(button)) {
+        if (action == GLFW_PRESS) {
+            self->m_buttonsLive.set(button);
+            self->m_buttonsLatched.set(button);
+        } else if (action == GLFW_RELEASE) {
+            self->m_buttonsLive.reset(button);
+        }
+    }
+    if (self->m_streamEvents) self->m_events.push({InputEvent::Type::MouseButton, button, action, mods, 0.0, 0.0, glfwGetTime()});
+}
+
+void Input::cursorPosCallback(GLFWwindow* window, double x, double y) {
+    Input* self = from(window);
+    if (self->m_prevCursorPos) self->m_prevCursorPos(window, x, y);
+    self->m_accumX += x - self->m_lastX;
+    self->m_accumY += y - self->m_lastY;
+    self->m_lastX = x; self->m_lastY = y;
+    if (self->m_streamEvents) self->m_events.push({InputEvent::Type::CursorPos, 0, 0, 0, x, y, glfwGetTime()});
+}
+
+void Input::scrollCallback(GLFWwindow* window, double dx, double dy) {
+    Input* self = from(window);
+    if (self->m_prevScroll) self->m_prevScroll(window, dx, dy);
+    if (self->m_streamEvents) self->m_events.push({InputEvent::Type::Scroll, 0, 0, 0, dx, dy, glfwGetTime()});
+}
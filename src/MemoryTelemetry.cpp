@@ -0,0 +1,195 @@
+#include "MemoryTelemetry.h"
+#include <vk_mem_alloc.h>
+#include <spdlog/spdlog.h>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <cstdio>
+
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+const char* const kTagNames[kMemoryTagCount] = {"Core", "Swapchain", "Frame", "ImGui", "Vma"};
+
+// Stored immediately before every pointer handed to the driver.
+struct AllocHeader {
+    void* raw;
+    size_t size;
+};
+
+constexpr double kMiB = 1024.0 * 1024.0;
+
+} // namespace
+
+const char* MemoryTagName(MemoryTag tag) { return kTagNames[static_cast<size_t>(tag)]; }
+
+bool MemoryTagFromName(std::string_view name, MemoryTag& out) {
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        if (name == kTagNames[i]) {
+            out = static_cast<MemoryTag>(i);
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t CurrentResidentBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return pmc.WorkingSetSize;
+    return 0;
+#elif defined(__linux__)
+    unsigned long long pages = 0, resident = 0;
+    FILE* f = std::fopen("/proc/self/statm", "r");
+    if (!f) return 0;
+    int fields = std::fscanf(f, "%llu %llu", &pages, &resident);
+    std::fclose(f);
+    return fields == 2 ? resident * static_cast<uint64_t>(sysconf(_SC_PAGESIZE)) : 0;
+#else
+    return 0;
+#endif
+}
+
+uint64_t PeakResidentBytes() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc{};
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return pmc.PeakWorkingSetSize;
+    return 0;
+#else
+    rusage ru{};
+    if (getrusage(RUSAGE_SELF, &ru) != 0) return 0;
+#ifdef __APPLE__
+    return static_cast<uint64_t>(ru.ru_maxrss);
+#else
+    return static_cast<uint64_t>(ru.ru_maxrss) * 1024u;
+#endif
+#endif
+}
+
+MemoryTelemetry::MemoryTelemetry() {
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        VkAllocationCallbacks& cb = m_callbacks[i];
+        cb.pUserData = &m_counters[i];
+        cb.pfnAllocation = allocate;
+        cb.pfnReallocation = reallocate;
+        cb.pfnFree = release;
+        cb.pfnInternalAllocation = internalAlloc;
+        cb.pfnInternalFree = internalFree;
+    }
+}
+
+MemoryTelemetry::HostStats MemoryTelemetry::host(MemoryTag tag) const {
+    const Counters& c = m_counters[static_cast<size_t>(tag)];
+    HostStats s;
+    s.bytes = c.bytes.load(std::memory_order_relaxed);
+    s.peakBytes = c.peak.load(std::memory_order_relaxed);
+    s.allocations = c.allocations.load(std::memory_order_relaxed);
+    s.budget = c.budget;
+    s.overBudget = c.overBudget;
+    s.everOverBudget = c.everOverBudget;
+    return s;
+}
+
+void MemoryTelemetry::update(VmaAllocator allocator) {
+    for (size_t i = 0; i < kMemoryTagCount; ++i) {
+        Counters& c = m_counters[i];
+        const uint64_t bytes = c.bytes.load(std::memory_order_relaxed);
+        const bool over = c.budget != 0 && bytes > c.budget;
+        if (over && !c.overBudget)
+            spdlog::warn("{} host memory over budget: {:.2f} MiB > {:.2f} MiB", kTagNames[i], bytes / kMiB, c.budget / kMiB);
+        c.overBudget = over;
+        c.everOverBudget |= over;
+    }
+
+    if (!allocator) return;
+    const VkPhysicalDeviceMemoryProperties* props = nullptr;
+    vmaGetMemoryProperties(allocator, &props);
+    VmaBudget budgets[VK_MAX_MEMORY_HEAPS]{};
+    vmaGetHeapBudgets(allocator, budgets);
+
+    m_heaps.resize(props->memoryHeapCount);
+    for (uint32_t h = 0; h < props->memoryHeapCount; ++h) {
+        HeapStats& heap = m_heaps[h];
+        heap.size = props->memoryHeaps[h].size;
+        heap.deviceLocal = (props->memoryHeaps[h].flags & VK_MEMORY_HEAP_DEVICE_LOCAL_BIT) != 0;
+        heap.usage = budgets[h].usage;
+        heap.budget = budgets[h].budget;
+        heap.blockBytes = budgets[h].statistics.blockBytes;
+        heap.allocationBytes = budgets[h].statistics.allocationBytes;
+        heap.blockCount = budgets[h].statistics.blockCount;
+        heap.allocationCount = budgets[h].statistics.allocationCount;
+
+        // Warn once when a heap passes 90% of what the driver says we may use.
+        const bool high = heap.budget != 0 && heap.usage * 10 > heap.budget * 9;
+        if (high && !heap.warned)
+            spdlog::warn("Memory heap {} at {:.1f} MiB of {:.1f} MiB budget", h, heap.usage / kMiB, heap.budget / kMiB);
+        heap.warned = high;
+    }
+}
+
+void MemoryTelemetry::add(Counters& c, size_t size) {
+    c.allocations.fetch_add(1, std::memory_order_relaxed);
+    uint64_t now = c.bytes.fetch_add(size, std::memory_order_relaxed) + size;
+    uint64_t peak = c.peak.load(std::memory_order_relaxed);
+    while (now > peak && !c.peak.compare_exchange_weak(peak, now, std::memory_order_relaxed)) {}
+}
+
+void MemoryTelemetry::sub(Counters& c, size_t size) {
+    c.allocations.fetch_sub(1, std::memory_order_relaxed);
+    c.bytes.fetch_sub(size, std::memory_order_relaxed);
+}
+
+// Drivers may call these from any thread, hence the atomic counters.
+VKAPI_ATTR void* VKAPI_CALL MemoryTelemetry::allocate(void* user, size_t size, size_t alignment,
+                                                      VkSystemAllocationScope) {
+    if (size == 0) return nullptr;
+    alignment = std::max(alignment, alignof(AllocHeader));
+    char* raw = static_cast<char*>(std::malloc(size + sizeof(AllocHeader) + alignment - 1));
+    if (!raw) return nullptr;
+    uintptr_t p = reinterpret_cast<uintptr_t>(raw) + sizeof(AllocHeader);
+    p = (p + alignment - 1) & ~static_cast<uintptr_t>(alignment - 1);
+    auto* header = reinterpret_cast<AllocHeader*>(p) - 1;
+    header->raw = raw;
+    header->size = size;
+    add(*static_cast<Counters*>(user), size);
+    return reinterpret_cast<void*>(p);
+}
+
+VKAPI_ATTR void* VKAPI_CALL MemoryTelemetry::reallocate(void* user, void* original, size_t size, size_t alignment,
+                                                        VkSystemAllocationScope scope) {
+    if (!original) return allocate(user, size, alignment, scope);
+    if (size == 0) {
+        release(user, original);
+        return nullptr;
+    }
+    void* fresh = allocate(user, size, alignment, scope);
+    if (!fresh) return nullptr;
+    std::memcpy(fresh, original, std::min(size, (static_cast<AllocHeader*>(original) - 1)->size));
+    release(user, original);
+    return fresh;
+}
+
+VKAPI_ATTR void VKAPI_CALL MemoryTelemetry::release(void* user, void* memory) {
+    if (!memory) return;
+    auto* header = static_cast<AllocHeader*>(memory) - 1;
+    sub(*static_cast<Counters*>(user), header->size);
+    std::free(header->raw);
+}
+
+VKAPI_ATTR void VKAPI_CALL MemoryTelemetry::internalAlloc(void* user, size_t size, VkInternalAllocationType,
+                                                          VkSystemAllocationScope) {
+    add(*static_cast<Counters*>(user), size);
+}
+
+VKAPI_ATTR void VKAPI_CALL MemoryTelemetry::internalFree(void* user, size_t size, VkInternalAllocationType,
+                                                         VkSystemAllocationScope) {
+    sub(*static_cast<Counters*>(user), size);
+}
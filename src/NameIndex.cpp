@@ -0,0 +1,105 @@
+#include "NameIndex.h"
+#include <algorithm>
+#include <cctype>
+
+namespace {
+
+unsigned char Lower(char c) { return static_cast<unsigned char>(std::tolower(static_cast<unsigned char>(c))); }
+
+// Packs up to three lowercase chars plus the length into one key.
+uint32_t PackGram(std::string_view s, size_t pos, size_t len) {
+    uint32_t key = static_cast<uint32_t>(len) << 24;
+    for (size_t i = 0; i < len; ++i) key |= uint32_t(Lower(s[pos + i])) << (8 * i);
+    return key;
+}
+
+// True if the gram packed in `key` contains `query` (1-2 chars, matched case-insensitively).
+bool GramContains(uint32_t key, std::string_view query) {
+    const size_t len = key >> 24;
+    for (size_t i = 0; i + query.size() <= len; ++i) {
+        size_t j = 0;
+        while (j < query.size() && ((key >> (8 * (i + j))) & 0xff) == Lower(query[j])) ++j;
+        if (j == query.size()) return true;
+    }
+    return false;
+}
+
+bool ContainsNoCase(std::string_view hay, std::string_view needle) {
+    return std::search(hay.begin(), hay.end(), needle.begin(), needle.end(),
+                       [](char a, char b) { return Lower(a) == Lower(b); }) != hay.end();
+}
+
+} // namespace
+
+void NameIndex::collectGrams(std::string_view name, std::vector<uint32_t>& grams) {
+    grams.clear();
+    if (name.empty()) return;
+    // Every substring of up to three chars lies inside some key, which is what search() relies on.
+    const size_t len = std::min<size_t>(name.size(), 3);
+    for (size_t i = 0; i + len <= name.size(); ++i) grams.push_back(PackGram(name, i, len));
+    std::sort(grams.begin(), grams.end());
+    grams.erase(std::unique(grams.begin(), grams.end()), grams.end());
+}
+
+void NameIndex::add(uint32_t id, std::string_view name) {
+    thread_local std::vector<uint32_t> grams;
+    collectGrams(name, grams);
+    for (uint32_t g : grams) {
+        auto& ids = m_postings[g];
+        // Ids are usually created in increasing order, so this is an append.
+        if (ids.empty() || ids.back() < id) ids.push_back(id);
+        else {
+            auto it = std::lower_bound(ids.begin(), ids.end(), id);
+            if (it == ids.end() || *it != id) ids.insert(it, id);
+        }
+    }
+}
+
+void NameIndex::remove(uint32_t id, std::string_view name) {
+    thread_local std::vector<uint32_t> grams;
+    collectGrams(name, grams);
+    for (uint32_t g : grams) {
+        auto found = m_postings.find(g);
+        if (found == m_postings.end()) continue;
+        auto& ids = found->second;
+        auto it = std::lower_bound(ids.begin(), ids.end(), id);
+        if (it != ids.end() && *it == id) ids.erase(it);
+        if (ids.empty()) m_postings.erase(found);
+    }
+}
+
+void NameIndex::search(std::string_view query, const NameLookup& nameOf, std::vector<uint32_t>& out) const {
+    out.clear();
+    if (query.empty()) return;
+
+    // Shorter than a trigram: union the postings of every key that contains the query.
+    // Lists overlap heavily (one name has many such grams), so merge through a bitmap.
+    if (query.size() < 3) {
+        std::vector<bool> hit;
+        for (const auto& [gram, ids] : m_postings) {
+            if (!GramContains(gram, query)) continue;
+            if (hit.size() <= ids.back()) hit.resize(size_t(ids.back()) + 1);
+            for (uint32_t id : ids) hit[id] = true;
+        }
+        for (size_t id = 0; id < hit.size(); ++id)
+            if (hit[id]) out.push_back(static_cast<uint32_t>(id));
+        return;
+    }
+
+    std::vector<const std::vector<uint32_t>*> lists;
+    for (size_t i = 0; i + 3 <= query.size(); ++i) {
+        auto it = m_postings.find(PackGram(query, i, 3));
+        if (it == m_postings.end()) return;
+        lists.push_back(&it->second);
+    }
+    std::sort(lists.begin(), lists.end(), [](auto* a, auto* b) { return a->size() < b->size(); });
+
+    // Intersect starting from the rarest gram, then verify the actual substring.
+    for (uint32_t id : *lists.front()) {
+        bool all = true;
+        for (size_t i = 1; i < lists.size() && all; ++i)
+            all = std::binary_search(lists[i]->begin(), lists[i]->end(), id);
+        if (!all) continue;
+        if (query.size() == 3 || ContainsNoCase(nameOf(id), query)) out.push_back(id);
+    }
+}
@@ -3,15 +3,18 @@
 #include "Window.h"
 #include <GLFW/glfw3.h>
 #include <spdlog/spdlog.h>
+#include <vk_mem_alloc.h>
 #include <vector>
 #include <stdexcept>
 #include <algorithm>
+#include <cstring>
 
-Renderer::Renderer(Window& window) : m_window(window) {
+Renderer::Renderer(Window& window, bool vsync) : m_window(window), m_vsync(vsync) {
     createInstance();
     createSurface();
     pickPhysicalDevice();
     createDevice();
+    createAllocator();
     createSwapchain();
     createImageViews();
     createRenderPass();
@@ -20,36 +23,48 @@ Renderer::Renderer(Window& window) : m_window(window) {
     createCommandBuffers();
     createSyncObjects();
     createImguiDescriptorPool();
+    createTimestampQueries();
 }
 
 Renderer::~Renderer() {
     vkDeviceWaitIdle(m_device);
-    vkDestroyDescriptorPool(m_device, m_imguiDescriptorPool, nullptr);
-    vkDestroyFence(m_device, m_inFlight, nullptr);
-    vkDestroySemaphore(m_device, m_renderFinished, nullptr);
-    vkDestroySemaphore(m_device, m_imageAvailable, nullptr);
-    vkDestroyCommandPool(m_device, m_commandPool, nullptr);
-    for (auto fb : m_framebuffers) vkDestroyFramebuffer(m_device, fb, nullptr);
-    vkDestroyRenderPass(m_device, m_renderPass, nullptr);
-    for (auto iv : m_swapImageViews) vkDestroyImageView(m_device, iv, nullptr);
-    vkDestroySwapchainKHR(m_device, m_swapchain, nullptr);
-    vkDestroyDevice(m_device, nullptr);
+    if (m_timestampPool) vkDestroyQueryPool(m_device, m_timestampPool, m_memory.callbacks(MemoryTag::Frame));
+    vkDestroyDescriptorPool(m_device, m_imguiDescriptorPool, m_memory.callbacks(MemoryTag::ImGui));
+    vkDestroyFence(m_device, m_inFlight, m_memory.callbacks(MemoryTag::Frame));
+    vkDestroySemaphore(m_device, m_renderFinished, m_memory.callbacks(MemoryTag::Frame));
+    vkDestroySemaphore(m_device, m_imageAvailable, m_memory.callbacks(MemoryTag::Frame));
+    vkDestroyCommandPool(m_device, m_commandPool, m_memory.callbacks(MemoryTag::Frame));
+    for (auto fb : m_framebuffers) vkDestroyFramebuffer(m_device, fb, m_memory.callbacks(MemoryTag::Swapchain));
+    vkDestroyRenderPass(m_device, m_renderPass, m_memory.callbacks(MemoryTag::Swapchain));
+    for (auto iv : m_swapImageViews) vkDestroyImageView(m_device, iv, m_memory.callbacks(MemoryTag::Swapchain));
+    vkDestroySwapchainKHR(m_device, m_swapchain, m_memory.callbacks(MemoryTag::Swapchain));
+    vmaDestroyAllocator(m_allocator);
+    vkDestroyDevice(m_device, m_memory.callbacks(MemoryTag::Core));
     vkDestroySurfaceKHR(m_instance, m_surface, nullptr);
-    vkDestroyInstance(m_instance, nullptr);
+    vkDestroyInstance(m_instance, m_memory.callbacks(MemoryTag::Core));
 }
 
-void Renderer::waitIdle() { vkDeviceWaitIdle(m_device); }
+void Renderer::waitIdle() {
+    vkDeviceWaitIdle(m_device);
+    readTimestampQueries();
+}
 
 void Renderer::beginFrame() {
     if (m_frameBegun) throw std::runtime_error("beginFrame called twice");
     vkWaitForFences(m_device, 1, &m_inFlight, VK_TRUE, UINT64_MAX);
     vkResetFences(m_device, 1, &m_inFlight);
+    readTimestampQueries();
+    m_memory.update(m_allocator);
 
     vkAcquireNextImageKHR(m_device, m_swapchain, UINT64_MAX, m_imageAvailable, VK_NULL_HANDLE, &m_currentImage);
 
     auto cmd = m_cmdBuffers[m_currentImage];
     VkCommandBufferBeginInfo bi{VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO};
     vkBeginCommandBuffer(cmd, &bi);
+    if (m_timestampPool) {
+        vkCmdResetQueryPool(cmd, m_timestampPool, 0, 2);
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, m_timestampPool, 0);
+    }
 
     VkClearValue clear{};
     clear.color = {{0.05f, 0.07f, 0.1f, 1.0f}};
@@ -69,6 +84,10 @@ void Renderer::endFrame() {
     if (!m_frameBegun) return;
     auto cmd = m_cmdBuffers[m_currentImage];
     vkCmdEndRenderPass(cmd);
+    if (m_timestampPool) {
+        vkCmdWriteTimestamp(cmd, VK_PIPELINE_STAGE_BOTTOM_OF_PIPE_BIT, m_timestampPool, 1);
+        m_timestampsPending = true;
+    }
     vkEndCommandBuffer(cmd);
 
     VkPipelineStageFlags waitStages[] = {VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT};
@@ -115,7 +134,7 @@ void Renderer::createInstance() {
     ci.enabledExtensionCount = (uint32_t)exts.size();
     ci.ppEnabledExtensionNames = exts.data();
 
-    if (vkCreateInstance(&ci, nullptr, &m_instance) != VK_SUCCESS)
+    if (vkCreateInstance(&ci, m_memory.callbacks(MemoryTag::Core), &m_instance) != VK_SUCCESS)
         throw std::runtime_error("vkCreateInstance failed");
 }
 
@@ -139,6 +158,7 @@ void Renderer::pickPhysicalDevice() {
             if ((props[i].queueFlags & VK_QUEUE_GRAPHICS_BIT) && present) {
                 m_physicalDevice = d;
                 m_graphicsFamily = i;
+                m_timestampValidBits = props[i].timestampValidBits;
                 return;
             }
         }
@@ -160,6 +180,17 @@ void Renderer::createDevice() {
 #endif
     };
 
+    uint32_t extCount = 0;
+    vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &extCount, nullptr);
+    std::vector<VkExtensionProperties> available(extCount);
+    vkEnumerateDeviceExtensionProperties(m_physicalDevice, nullptr, &extCount, available.data());
+    for (const auto& e : available) {
+        if (std::strcmp(e.extensionName, VK_EXT_MEMORY_BUDGET_EXTENSION_NAME) == 0) {
+            exts.push_back(VK_EXT_MEMORY_BUDGET_EXTENSION_NAME);
+            m_memoryBudgetExt = true;
+        }
+    }
+
     VkPhysicalDeviceFeatures2 feats{VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2};
 
     VkDeviceCreateInfo ci{VK_STRUCTURE_TYPE_DEVICE_CREATE_INFO};
@@ -169,7 +200,7 @@ void Renderer::createDevice() {
     ci.enabledExtensionCount = (uint32_t)exts.size();
     ci.ppEnabledExtensionNames = exts.data();
 
-    if (vkCreateDevice(m_physicalDevice, &ci, nullptr, &m_device) != VK_SUCCESS)
+    if (vkCreateDevice(m_physicalDevice, &ci, m_memory.callbacks(MemoryTag::Core), &m_device) != VK_SUCCESS)
         throw std::runtime_error("vkCreateDevice failed");
     vkGetDeviceQueue(m_device, m_graphicsFamily, 0, &m_graphicsQueue);
 }
@@ -188,6 +219,10 @@ VkSurfaceFormatKHR Renderer::chooseSurfaceFormat(const std::vector<VkSurfaceForm
 }
 
 VkPresentModeKHR Renderer::choosePresentMode(const std::vector<VkPresentModeKHR>& modes) {
+    if (!m_vsync) {
+        for (auto m : modes) if (m == VK_PRESENT_MODE_IMMEDIATE_KHR) return m;
+        for (auto m : modes) if (m == VK_PRESENT_MODE_MAILBOX_KHR) return m;
+    }
 #ifdef TRIPLE_BUFFERING
     for (auto m : modes) if (m == VK_PRESENT_MODE_MAILBOX_KHR) return m;
 #endif
@@ -242,7 +277,7 @@ void Renderer::createSwapchain() {
     ci.presentMode = presentMode;
     ci.clipped = VK_TRUE;
 
-    if (vkCreateSwapchainKHR(m_device, &ci, nullptr, &m_swapchain) != VK_SUCCESS)
+    if (vkCreateSwapchainKHR(m_device, &ci, m_memory.callbacks(MemoryTag::Swapchain), &m_swapchain) != VK_SUCCESS)
         throw std::runtime_error("vkCreateSwapchainKHR failed");
 
     uint32_t count=0; vkGetSwapchainImagesKHR(m_device, m_swapchain, &count, nullptr);
@@ -264,7 +299,7 @@ void Renderer::createImageViews() {
         iv.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
         iv.subresourceRange.levelCount = 1;
         iv.subresourceRange.layerCount = 1;
-        if (vkCreateImageView(m_device, &iv, nullptr, &m_swapImageViews[i]) != VK_SUCCESS)
+        if (vkCreateImageView(m_device, &iv, m_memory.callbacks(MemoryTag::Swapchain), &m_swapImageViews[i]) != VK_SUCCESS)
             throw std::runtime_error("vkCreateImageView failed");
     }
 }
@@ -291,7 +326,7 @@ void Renderer::createRenderPass() {
     rp.subpassCount = 1;
     rp.pSubpasses = &sub;
 
-    if (vkCreateRenderPass(m_device, &rp, nullptr, &m_renderPass) != VK_SUCCESS)
+    if (vkCreateRenderPass(m_device, &rp, m_memory.callbacks(MemoryTag::Swapchain), &m_renderPass) != VK_SUCCESS)
         throw std::runtime_error("vkCreateRenderPass failed");
 }
 
@@ -306,7 +341,7 @@ void Renderer::createFramebuffers() {
         fb.width = m_swapExtent.width;
         fb.height = m_swapExtent.height;
         fb.layers = 1;
-        if (vkCreateFramebuffer(m_device, &fb, nullptr, &m_framebuffers[i]) != VK_SUCCESS)
+        if (vkCreateFramebuffer(m_device, &fb, m_memory.callbacks(MemoryTag::Swapchain), &m_framebuffers[i]) != VK_SUCCESS)
             throw std::runtime_error("vkCreateFramebuffer failed");
     }
 }
@@ -315,7 +350,7 @@ void Renderer::createCommandPool() {
     VkCommandPoolCreateInfo ci{VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO};
     ci.queueFamilyIndex = m_graphicsFamily;
     ci.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
-    if (vkCreateCommandPool(m_device, &ci, nullptr, &m_commandPool) != VK_SUCCESS)
+    if (vkCreateCommandPool(m_device, &ci, m_memory.callbacks(MemoryTag::Frame), &m_commandPool) != VK_SUCCESS)
         throw std::runtime_error("vkCreateCommandPool failed");
 }
 
@@ -333,9 +368,9 @@ void Renderer::createSyncObjects() {
     VkSemaphoreCreateInfo si{VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO};
     VkFenceCreateInfo fi{VK_STRUCTURE_TYPE_FENCE_CREATE_INFO};
     fi.flags = VK_FENCE_CREATE_SIGNALED_BIT;
-    if (vkCreateSemaphore(m_device, &si, nullptr, &m_imageAvailable) != VK_SUCCESS ||
-        vkCreateSemaphore(m_device, &si, nullptr, &m_renderFinished) != VK_SUCCESS ||
-        vkCreateFence(m_device, &fi, nullptr, &m_inFlight) != VK_SUCCESS)
+    if (vkCreateSemaphore(m_device, &si, m_memory.callbacks(MemoryTag::Frame), &m_imageAvailable) != VK_SUCCESS ||
+        vkCreateSemaphore(m_device, &si, m_memory.callbacks(MemoryTag::Frame), &m_renderFinished) != VK_SUCCESS ||
+        vkCreateFence(m_device, &fi, m_memory.callbacks(MemoryTag::Frame), &m_inFlight) != VK_SUCCESS)
         throw std::runtime_error("sync object creation failed");
 }
 
@@ -359,6 +394,51 @@ void Renderer::createImguiDescriptorPool() {
     pool_info.maxSets = 1000 * (uint32_t)(sizeof(pool_sizes)/sizeof(pool_sizes[0]));
     pool_info.poolSizeCount = (uint32_t)(sizeof(pool_sizes)/sizeof(pool_sizes[0]));
     pool_info.pPoolSizes = pool_sizes;
-    if (vkCreateDescriptorPool(m_device, &pool_info, nullptr, &m_imguiDescriptorPool) != VK_SUCCESS)
+    if (vkCreateDescriptorPool(m_device, &pool_info, m_memory.callbacks(MemoryTag::ImGui), &m_imguiDescriptorPool) != VK_SUCCESS)
         throw std::runtime_error("Failed to create ImGui descriptor pool");
 }
+
+void Renderer::createTimestampQueries() {
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+    m_timestampPeriod = props.limits.timestampPeriod;
+    if (m_timestampValidBits == 0 || m_timestampPeriod <= 0.0f) {
+        spdlog::warn("GPU timestamps unsupported on graphics queue; GPU frame time unavailable");
+        return;
+    }
+    VkQueryPoolCreateInfo qi{VK_STRUCTURE_TYPE_QUERY_POOL_CREATE_INFO};
+    qi.queryType = VK_QUERY_TYPE_TIMESTAMP;
+    qi.queryCount = 2;
+    if (vkCreateQueryPool(m_device, &qi, m_memory.callbacks(MemoryTag::Frame), &m_timestampPool) != VK_SUCCESS)
+        throw std::runtime_error("vkCreateQueryPool failed");
+}
+
+void Renderer::readTimestampQueries() {
+    // Only called after the in-flight fence or device idle, so the last submitted frame's queries are complete.
+    if (!m_timestampsPending) return;
+    m_timestampsPending = false;
+    uint64_t ts[2]{};
+    if (vkGetQueryPoolResults(m_device, m_timestampPool, 0, 2, sizeof(ts), ts, sizeof(uint64_t),
+                              VK_QUERY_RESULT_64_BIT) != VK_SUCCESS) return;
+    uint64_t mask = m_timestampValidBits >= 64 ? ~0ull : ((1ull << m_timestampValidBits) - 1);
+    uint64_t ticks = ((ts[1] & mask) - (ts[0] & mask)) & mask;
+    m_gpuFrameMs = double(ticks) * double(m_timestampPeriod) * 1e-6;
+    m_gpuFrameReady = true;
+}
+
+void Renderer::createAllocator() {
+    VkPhysicalDeviceProperties props{};
+    vkGetPhysicalDeviceProperties(m_physicalDevice, &props);
+
+    VmaAllocatorCreateInfo ci{};
+    ci.instance = m_instance;
+    ci.physicalDevice = m_physicalDevice;
+    ci.device = m_device;
+    ci.vulkanApiVersion = std::min(props.apiVersion, VK_API_VERSION_1_3);
+    ci.pAllocationCallbacks = m_memory.callbacks(MemoryTag::Vma);
+    if (m_memoryBudgetExt) ci.flags |= VMA_ALLOCATOR_CREATE_EXT_MEMORY_BUDGET_BIT;
+    if (vmaCreateAllocator(&ci, &m_allocator) != VK_SUCCESS)
+        throw std::runtime_error("vmaCreateAllocator failed");
+    if (!m_memoryBudgetExt)
+        spdlog::info("VK_EXT_memory_budget unavailable; heap usage is VMA's own estimate");
+}
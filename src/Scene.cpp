@@ -1,7 +1,119 @@
-
 #include "Scene.h"
+#include <stdexcept>
+
+GameObject& Scene::create(std::string_view name) {
+    if (m_objects.size() >= kShared - 1) throw std::length_error("Scene object limit reached");
+    const uint32_t index = static_cast<uint32_t>(m_objects.size());
+    GameObject& obj = m_objects.emplace_back();
+    obj.name = StringPool::global().intern(name);
+    link(index);
+    m_nameIndex.add(index, obj.nameView());
+    ++m_revision;
+    return obj;
+}
+
+void Scene::rename(uint32_t index, std::string_view name) {
+    auto& obj = m_objects.at(index);
+    StringPool& pool = StringPool::global();
+    if (pool.find(name) == obj.name) return;   // no-op renames don't grow the pool
+    NameId id = pool.intern(name);
+    unlink(index);
+    m_nameIndex.remove(index, obj.nameView());
+    obj.name = id;
+    link(index);
+    m_nameIndex.add(index, obj.nameView());
+    ++m_revision;
+}
+
+uint32_t Scene::find(std::string_view name) const {
+    NameId id = StringPool::global().find(name);
+    if (id == StringPool::kInvalid || m_names.empty()) return kNone;
+    const uint32_t newest = m_names[nameSlot(id)];
+    if (newest == kNone || !(newest & kShared)) return newest;
+    return m_sameName.get(newest & ~kShared);   // the list wraps from newest to oldest
+}
+
+uint32_t Scene::nextWithSameName(uint32_t index) const {
+    // Unique names have no entry; the only backwards step in the list is newest -> oldest.
+    const uint32_t next = m_sameName.get(index);
+    return next == IndexMap::kEmpty || next < index ? kNone : next;
+}
+
+// Slot holding `name`, or the empty slot where it would go. Requires a non-empty table.
+size_t Scene::nameSlot(NameId name) const {
+    const size_t mask = m_names.size() - 1;
+    size_t i = HashIndex(name) & mask;
+    while (m_names[i] != kNone && m_objects[m_names[i] & ~kShared].name != name) i = (i + 1) & mask;
+    return i;
+}
+
+void Scene::growNames() {
+    std::vector<uint32_t> old(m_names.empty() ? 16 : m_names.size() * 2, kNone);
+    old.swap(m_names);
+    const size_t mask = m_names.size() - 1;
+    for (uint32_t entry : old) {
+        if (entry == kNone) continue;
+        size_t i = HashIndex(m_objects[entry & ~kShared].name) & mask;
+        while (m_names[i] != kNone) i = (i + 1) & mask;
+        m_names[i] = entry;
+    }
+}
+
+// Lists stay in index order so find() returns the oldest object with a name. New objects
+// always append; only renames walk a list.
+void Scene::link(uint32_t index) {
+    if ((m_nameCount + 1) * 10 > m_names.size() * 7) growNames();
+    uint32_t& slot = m_names[nameSlot(m_objects[index].name)];
+    if (slot == kNone) {
+        slot = index;
+        ++m_nameCount;
+        return;
+    }
+    const uint32_t newest = slot & ~kShared;
+    const uint32_t oldest = slot & kShared ? m_sameName.get(newest) : newest;
+    if (index > newest) {
+        m_sameName.set(newest, index);
+        m_sameName.set(index, oldest);
+        slot = index | kShared;
+        return;
+    }
+    uint32_t prev = newest, next = oldest;
+    while (next < index) {
+        prev = next;
+        next = m_sameName.get(next);
+    }
+    m_sameName.set(prev, index);
+    m_sameName.set(index, next);
+    slot |= kShared;
+}
 
-GameObject& Scene::create(const std::string& name) {
-    m_objects.push_back({name});
-    return m_objects.back();
+void Scene::unlink(uint32_t index) {
+    const size_t at = nameSlot(m_objects[index].name);
+    if (!(m_names[at] & kShared)) {
+        // Last object with this name: backward-shift the rest of the probe run into the hole.
+        const size_t mask = m_names.size() - 1;
+        size_t hole = at;
+        for (size_t j = (hole + 1) & mask; m_names[j] != kNone; j = (j + 1) & mask) {
+            const size_t home = HashIndex(m_objects[m_names[j] & ~kShared].name) & mask;
+            if (((j - home) & mask) >= ((j - hole) & mask)) {
+                m_names[hole] = m_names[j];
+                hole = j;
+            }
+        }
+        m_names[hole] = kNone;
+        --m_nameCount;
+        return;
+    }
+    uint32_t newest = m_names[at] & ~kShared;
+    uint32_t prev = newest;
+    while (m_sameName.get(prev) != index) prev = m_sameName.get(prev);
+    m_sameName.set(prev, m_sameName.get(index));
+    m_sameName.erase(index);
+    if (index == newest) newest = prev;
+    if (m_sameName.get(prev) == prev) {   // one object left: the name is unique again
+        m_sameName.erase(prev);
+        m_names[at] = prev;
+    } else {
+        m_names[at] = newest | kShared;
+    }
 }
@@ -0,0 +1,130 @@
+#include "SceneOutliner.h"
+#include "Scene.h"
+
+#include <imgui.h>
+#include <algorithm>
+#include <cfloat>
+#include <cstring>
+#include <string_view>
+
+void SceneOutliner::draw(Scene& scene) {
+    if (ImGui::Begin("Scene")) {
+        ImGui::InputText("Name", m_newName, IM_ARRAYSIZE(m_newName));
+        if (ImGui::Button("Add GameObject")) scene.create(m_newName);
+        ImGui::InputTextWithHint("Filter", "name contains...", m_filter, IM_ARRAYSIZE(m_filter));
+        refreshFilter(scene);
+
+        auto& objects = scene.objects();
+        const int rowCount = m_filtering ? static_cast<int>(m_matches.size()) : static_cast<int>(objects.size());
+        ImGui::Text("%d / %zu objects, %zu selected", rowCount, objects.size(), m_selection.size());
+        if (!m_selection.empty()) {
+            ImGui::SameLine();
+            if (ImGui::SmallButton("Clear selection")) clearSelection();
+        }
+        if (m_selection.size() == 1) {
+            uint32_t id = m_selection.front();
+            if (ImGui::InputText("Rename", m_rename, IM_ARRAYSIZE(m_rename), ImGuiInputTextFlags_EnterReturnsTrue))
+                scene.rename(id, m_rename);
+        }
+        ImGui::Separator();
+
+        // Dragging a selected row's value applies the same delta to every selected object.
+        auto editColumn = [&](uint32_t id, const char* label, glm::vec3 GameObject::*field, float speed) {
+            glm::vec3& value = objects[id].*field;
+            glm::vec3 before = value;
+            ImGui::SetNextItemWidth(-FLT_MIN);
+            if (ImGui::DragFloat3(label, &value.x, speed) && isSelected(id)) {
+                glm::vec3 delta = value - before;
+                for (uint32_t other : m_selection)
+                    if (other != id) objects[other].*field += delta;
+            }
+        };
+
+        const ImGuiTableFlags flags = ImGuiTableFlags_ScrollY | ImGuiTableFlags_RowBg |
+                                      ImGuiTableFlags_BordersV | ImGuiTableFlags_Resizable;
+        if (ImGui::BeginTable("Objects", 4, flags)) {
+            ImGui::TableSetupScrollFreeze(0, 1);
+            ImGui::TableSetupColumn("Name");
+            ImGui::TableSetupColumn("Position");
+            ImGui::TableSetupColumn("Rotation");
+            ImGui::TableSetupColumn("Scale");
+            ImGui::TableHeadersRow();
+
+            ImGuiListClipper clipper;
+            clipper.Begin(rowCount);
+            while (clipper.Step()) {
+                for (int row = clipper.DisplayStart; row < clipper.DisplayEnd; ++row) {
+                    uint32_t id = rowToId(row);
+                    ImGui::PushID(static_cast<int>(id));
+                    ImGui::TableNextRow();
+                    ImGui::TableNextColumn();
+                    if (ImGui::Selectable(objects[id].nameCStr(), isSelected(id))) handleClick(scene, id, row);
+                    ImGui::TableNextColumn();
+                    editColumn(id, "##Position", &GameObject::position, 0.1f);
+                    ImGui::TableNextColumn();
+                    editColumn(id, "##Rotation", &GameObject::rotation, 0.5f);
+                    ImGui::TableNextColumn();
+                    editColumn(id, "##Scale", &GameObject::scale, 0.1f);
+                    ImGui::PopID();
+                }
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
+void SceneOutliner::refreshFilter(Scene& scene) {
+    std::string_view text = m_filter;
+    m_filtering = !text.empty();
+    if (text == m_lastFilter && scene.revision() == m_lastRevision) return;
+    if (text != m_lastFilter) m_anchorRow = -1;
+    m_lastFilter = text;
+    m_lastRevision = scene.revision();
+    if (!m_filtering) {
+        m_matches.clear();
+        return;
+    }
+    auto& objects = scene.objects();
+    scene.nameIndex().search(text, [&](uint32_t id) -> std::string_view { return objects[id].nameView(); }, m_matches);
+}
+
+void SceneOutliner::select(uint32_t id) {
+    if (id >= m_selectedFlags.size()) m_selectedFlags.resize(id + 1, 0);
+    if (m_selectedFlags[id]) return;
+    m_selectedFlags[id] = 1;
+    m_selection.push_back(id);
+}
+
+void SceneOutliner::deselect(uint32_t id) {
+    if (!isSelected(id)) return;
+    m_selectedFlags[id] = 0;
+    m_selection.erase(std::find(m_selection.begin(), m_selection.end(), id));
+}
+
+void SceneOutliner::clearSelection() {
+    for (uint32_t id : m_selection) m_selectedFlags[id] = 0;
+    m_selection.clear();
+}
+
+void SceneOutliner::handleClick(Scene& scene, uint32_t id, int row) {
+    const ImGuiIO& io = ImGui::GetIO();
+    if (io.KeyShift && m_anchorRow >= 0) {
+        if (!io.KeyCtrl) clearSelection();
+        for (int r = std::min(m_anchorRow, row); r <= std::max(m_anchorRow, row); ++r) select(rowToId(r));
+    } else {
+        if (io.KeyCtrl) {
+            if (isSelected(id)) deselect(id); else select(id);
+        } else {
+            clearSelection();
+            select(id);
+        }
+        m_anchorRow = row;
+    }
+    if (m_selection.size() == 1) {
+        std::string_view name = scene.objects()[m_selection.front()].nameView();
+        size_t len = std::min(name.size(), sizeof(m_rename) - 1);
+        std::memcpy(m_rename, name.data(), len);
+        m_rename[len] = '\0';
+    }
+}
@@ -0,0 +1,101 @@
+#include "StringPool.h"
+#include <stdexcept>
+
+namespace {
+
+// FNV-1a.
+uint32_t Hash(std::string_view s) {
+    uint32_t h = 2166136261u;
+    for (char c : s) h = (h ^ static_cast<unsigned char>(c)) * 16777619u;
+    return h;
+}
+
+StringPool* g_current = nullptr;
+
+} // namespace
+
+StringPool& StringPool::global() {
+    static StringPool pool;
+    return g_current ? *g_current : pool;
+}
+
+StringPool::Scoped::Scoped(StringPool& pool) : m_previous(g_current) { g_current = &pool; }
+StringPool::Scoped::~Scoped() { g_current = m_previous; }
+
+StringPool::StringPool() {
+    m_slots.assign(1024, kInvalid);
+    intern("");
+}
+
+NameId StringPool::intern(std::string_view s) {
+    const uint32_t hash = Hash(s);
+    const size_t slot = probe(s, hash);
+    if (m_slots[slot] != kInvalid) return m_slots[slot];
+    if (s.size() >= UINT32_MAX) throw std::length_error("StringPool exhausted");
+
+    const NameId id = store(s);
+    m_slots[slot] = id;
+    if (++m_count * 10 > m_slots.size() * 7) grow();
+    return id;
+}
+
+NameId StringPool::find(std::string_view s) const {
+    return m_slots[probe(s, Hash(s))];
+}
+
+// Slot holding `s`, or the empty slot where it would go.
+size_t StringPool::probe(std::string_view s, uint32_t hash) const {
+    const size_t mask = m_slots.size() - 1;
+    for (size_t i = hash & mask;; i = (i + 1) & mask) {
+        const NameId id = m_slots[i];
+        if (id == kInvalid || view(id) == s) return i;
+    }
+}
+
+void StringPool::grow() {
+    std::vector<NameId> old(m_slots.size() * 2, kInvalid);
+    old.swap(m_slots);
+    const size_t mask = m_slots.size() - 1;
+    for (NameId id : old) {
+        if (id == kInvalid) continue;
+        size_t i = Hash(view(id)) & mask;
+        while (m_slots[i] != kInvalid) i = (i + 1) & mask;
+        m_slots[i] = id;
+    }
+}
+
+NameId StringPool::store(std::string_view s) {
+    const uint32_t size = static_cast<uint32_t>(s.size());
+    const size_t header = size < 0xFF ? 1 : 5;
+    const size_t bytes = header + s.size() + 1;
+    size_t block, offset;
+    if (bytes > kLargeString) {
+        if (m_blocks.size() >= kMaxBlocks) throw std::length_error("StringPool exhausted");
+        m_blocks.push_back(std::make_unique<char[]>(bytes));
+        m_arenaBytes += bytes;
+        block = m_blocks.size() - 1;
+        offset = 0;
+    } else {
+        if (bytes > kBlockSize - m_cursor) {
+            if (m_blocks.size() >= kMaxBlocks) throw std::length_error("StringPool exhausted");
+            m_blocks.push_back(std::make_unique<char[]>(kBlockSize));
+            m_arenaBytes += kBlockSize;
+            m_cursorBlock = m_blocks.size() - 1;
+            m_cursor = 0;
+        }
+        block = m_cursorBlock;
+        offset = m_cursor;
+        m_cursor += bytes;
+    }
+
+    char* dst = m_blocks[block].get() + offset;
+    if (header == 1) {
+        dst[0] = static_cast<char>(size);
+    } else {
+        dst[0] = static_cast<char>(0xFF);
+        std::memcpy(dst + 1, &size, sizeof(size));
+    }
+    if (size) std::memcpy(dst + header, s.data(), size);
+    dst[header + size] = '\0';
+    return static_cast<NameId>((block << 16) | offset);
+}
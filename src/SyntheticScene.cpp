@@ -0,0 +1,24 @@
+#include "SyntheticScene.h"
+#include "Scene.h"
+#include <cstdio>
+#include <string_view>
+
+uint32_t GridSide(uint32_t count) {
+    uint32_t side = 1;
+    while (uint64_t(side) * side * side < count) ++side;
+    return side;
+}
+
+void PopulateGridScene(Scene& scene, uint32_t count) {
+    const uint32_t side = GridSide(count);
+    const float half = float(side);
+    char name[32];
+    for (uint32_t i = 0; i < count; ++i) {
+        int len = std::snprintf(name, sizeof(name), "Object_%u", i);
+        auto& obj = scene.create(std::string_view(name, static_cast<size_t>(len)));
+        obj.position = glm::vec3(float(i % side), float((i / side) % side), float(i / (side * side))) * 2.0f
+                     - glm::vec3(half);
+        obj.rotation = glm::vec3(float(i % 360), float((i * 7) % 360), 0.0f);
+        obj.scale = glm::vec3(1.0f + float(i % 3) * 0.5f);
+    }
+}
@@ -0,0 +1,16 @@
+#include "Visibility.h"
+#include "Scene.h"
+#include "Frustum.h"
+
+void ComputeVisibility(const std::vector<GameObject>& objects, const glm::mat4& viewProj,
+                       std::vector<glm::mat4>& models, std::vector<uint32_t>& visible) {
+    const Frustum frustum = Frustum::fromMatrix(viewProj);
+    models.resize(objects.size());
+    visible.clear();
+    for (size_t i = 0; i < objects.size(); ++i) {
+        const GameObject& obj = objects[i];
+        models[i] = obj.modelMatrix();
+        const float radius = 0.8660254f * glm::max(obj.scale.x, glm::max(obj.scale.y, obj.scale.z));
+        if (frustum.intersectsSphere(obj.position, radius)) visible.push_back(static_cast<uint32_t>(i));
+    }
+}
@@ -0,0 +1,3 @@
+// Single translation unit that compiles the VMA implementation.
+#define VMA_IMPLEMENTATION
+#include <vk_mem_alloc.h>
@@ -3,8 +3,15 @@
 #include <GLFW/glfw3.h>
 #include <stdexcept>
 
-Window::Window(int width, int height, const std::string& title)
+Window::Window(int width, int height, const std::string& title, bool headless)
     : m_width(width), m_height(height) {
+    if(headless) {
+#ifdef GLFW_PLATFORM_NULL
+        glfwInitHint(GLFW_PLATFORM, GLFW_PLATFORM_NULL);
+#else
+        throw std::runtime_error("Headless mode requires GLFW 3.4+");
+#endif
+    }
     if(!glfwInit()) throw std::runtime_error("GLFW init failed");
     glfwWindowHint(GLFW_CLIENT_API, GLFW_NO_API);
     m_window = glfwCreateWindow(width, height, title.c_str(), nullptr, nullptr);
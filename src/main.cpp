@@ -5,11 +5,21 @@
 #include "Scene.h"
 #include "Input.h"
 #include "Camera.h"
+#include "AppConfig.h"
+#include "FrameBench.h"
+#include "MemoryTelemetry.h"
+#include "SceneOutliner.h"
+#include "SyntheticScene.h"
 
 #include <imgui.h>
 #include <spdlog/spdlog.h>
 #include <GLFW/glfw3.h>
 #include <stdexcept>
+#include <algorithm>
+#include <cfloat>
+#include <cstdio>
+#include <chrono>
+#include <memory>
 
 static void DrawAxesOverlay(const Camera& cam) {
     ImDrawList* dl = ImGui::GetForegroundDrawList();
@@ -34,56 +44,136 @@ static void DrawAxesOverlay(const Camera& cam) {
     drawAxis(IM_COL32(80,160,255,255), glm::vec3(0,0,1), "Z");
 }
 
-int main() {
+// Reading RSS means a /proc read on Linux, so it is sampled a few times a second, and
+// not at all while a --bench run is timing frames.
+static void DrawMemoryPanel(MemoryTelemetry& memory, double now, bool sampleRss) {
+    constexpr double MiB = 1024.0 * 1024.0;
+    constexpr double kRssInterval = 0.25;
+    static double rssTime = -kRssInterval;
+    static uint64_t rss = 0, peakRss = 0;
+    if (sampleRss && now - rssTime >= kRssInterval) {
+        rss = CurrentResidentBytes();
+        peakRss = PeakResidentBytes();
+        rssTime = now;
+    }
+    if (ImGui::Begin("Memory")) {
+        if (sampleRss) ImGui::Text("Process RSS: %.1f MiB (peak %.1f MiB)", rss / MiB, peakRss / MiB);
+        else           ImGui::TextUnformatted("Process RSS: not sampled during --bench");
+
+        ImGui::Separator();
+        ImGui::TextUnformatted("Vulkan host allocations");
+        if (ImGui::BeginTable("Host", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+            ImGui::TableSetupColumn("Subsystem");
+            ImGui::TableSetupColumn("Current");
+            ImGui::TableSetupColumn("Peak");
+            ImGui::TableSetupColumn("Allocs");
+            ImGui::TableSetupColumn("Budget (MiB, 0 = none)");
+            ImGui::TableHeadersRow();
+            for (size_t i = 0; i < kMemoryTagCount; ++i) {
+                auto tag = static_cast<MemoryTag>(i);
+                auto s = memory.host(tag);
+                ImGui::PushID(static_cast<int>(i));
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn();
+                if (s.overBudget) ImGui::TextColored(ImVec4(1.0f, 0.35f, 0.3f, 1.0f), "%s", MemoryTagName(tag));
+                else              ImGui::TextUnformatted(MemoryTagName(tag));
+                ImGui::TableNextColumn(); ImGui::Text("%.2f MiB", s.bytes / MiB);
+                ImGui::TableNextColumn(); ImGui::Text("%.2f MiB", s.peakBytes / MiB);
+                ImGui::TableNextColumn(); ImGui::Text("%llu", static_cast<unsigned long long>(s.allocations));
+                ImGui::TableNextColumn();
+                float budgetMiB = static_cast<float>(s.budget / MiB);
+                ImGui::SetNextItemWidth(-FLT_MIN);
+                if (ImGui::DragFloat("##budget", &budgetMiB, 0.5f, 0.0f, 65536.0f, "%.1f"))
+                    memory.setBudget(tag, static_cast<uint64_t>(budgetMiB * MiB));
+                ImGui::PopID();
+            }
+            ImGui::EndTable();
+        }
+
+        ImGui::Separator();
+        ImGui::TextUnformatted("Device heaps");
+        if (ImGui::BeginTable("Heaps", 5, ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV)) {
+            ImGui::TableSetupColumn("Heap");
+            ImGui::TableSetupColumn("Usage");
+            ImGui::TableSetupColumn("Budget");
+            ImGui::TableSetupColumn("Size");
+            ImGui::TableSetupColumn("VMA blocks / allocs");
+            ImGui::TableHeadersRow();
+            const auto& heaps = memory.heaps();
+            for (size_t h = 0; h < heaps.size(); ++h) {
+                const auto& heap = heaps[h];
+                ImGui::TableNextRow();
+                ImGui::TableNextColumn(); ImGui::Text("%zu%s", h, heap.deviceLocal ? " (device)" : "");
+                ImGui::TableNextColumn();
+                float frac = heap.budget ? static_cast<float>(double(heap.usage) / double(heap.budget)) : 0.0f;
+                char label[32];
+                std::snprintf(label, sizeof(label), "%.1f MiB", heap.usage / MiB);
+                ImGui::ProgressBar(frac, ImVec2(-FLT_MIN, 0.0f), label);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f MiB", heap.budget / MiB);
+                ImGui::TableNextColumn(); ImGui::Text("%.1f MiB", heap.size / MiB);
+                ImGui::TableNextColumn();
+                ImGui::Text("%u / %u (%.1f MiB)", heap.blockCount, heap.allocationCount, heap.blockBytes / MiB);
+            }
+            ImGui::EndTable();
+        }
+    }
+    ImGui::End();
+}
+
+int main(int argc, char** argv) {
     try {
-        Window window(1600, 900, "Ignis");
-        Renderer renderer(window);
+        AppConfig config = ParseArgs(argc, argv);
+        std::unique_ptr<FrameBench> bench;
+        if (config.bench.enabled) bench = std::make_unique<FrameBench>(config.bench);
+
+        Window window(1600, 900, "Ignis", config.headless);
+        Renderer renderer(window, /*vsync=*/!bench);
+        for (const auto& [tag, bytes] : config.memoryBudgets) renderer.memory().setBudget(tag, bytes);
         ImGuiLayer imgui(window, renderer);
 
         Scene scene;
+        SceneOutliner outliner;
         scene.create("Camera");
         scene.create("Triangle");
+        if (bench) PopulateGridScene(scene, config.bench.objects);
 
         GLFWwindow* glfwWin = window.handle();
         Input input(glfwWin);
         Camera camera;
         double lastTime = glfwGetTime();
 
+        using Clock = std::chrono::steady_clock;
+        auto toMs = [](Clock::duration d) { return std::chrono::duration<double, std::milli>(d).count(); };
+
         while(!window.shouldClose()) {
+            auto frameStart = Clock::now();
             window.pollEvents();
             double now = glfwGetTime();
             float dt = static_cast<float>(now - lastTime);
             lastTime = now;
 
             input.beginFrame();
-            bool rmb = input.mouseDown(GLFW_MOUSE_BUTTON_RIGHT);
-            if (rmb) glfwSetInputMode(glfwWin, GLFW_CURSOR, GLFW_CURSOR_DISABLED);
-            else     glfwSetInputMode(glfwWin, GLFW_CURSOR, GLFW_CURSOR_NORMAL);
-            if (glfwGetKey(glfwWin, GLFW_KEY_ESCAPE) == GLFW_PRESS) break;
-            camera.update(dt, input, rmb);
+            if (input.keyDown(GLFW_KEY_ESCAPE)) break;
+            if (bench) {
+                // Scripted path replaces Input so every run renders the same frames.
+                bench->driveCamera(camera);
+                VkExtent2D extent = renderer.swapchainExtent();
+                bench->simulate(scene, camera, float(extent.width) / float(std::max(extent.height, 1u)));
+            } else {
+                bool rmb = input.mouseDown(GLFW_MOUSE_BUTTON_RIGHT);
+                input.setCursorCaptured(rmb);
+                camera.update(dt, input, rmb);
+            }
 
+            auto waitStart = Clock::now();
             renderer.beginFrame();
+            double waitMs = toMs(Clock::now() - waitStart);
+            double gpuMs = 0.0;
+            if (bench && renderer.takeGpuFrameMs(gpuMs)) bench->recordGpu(gpuMs);
             imgui.begin();
 
             ImGui::DockSpaceOverViewport(ImGui::GetMainViewport());
-            if (ImGui::Begin("Scene")) {
-                static char nameBuf[128] = "NewObject";
-                ImGui::InputText("Name", nameBuf, IM_ARRAYSIZE(nameBuf));
-                if (ImGui::Button("Add GameObject")) scene.create(nameBuf);
-                ImGui::Separator();
-                int idx = 0;
-                for (auto& obj : scene.objects()) {
-                    ImGui::PushID(idx++);
-                    if (ImGui::TreeNode(obj.name.c_str())) {
-                        ImGui::DragFloat3("Position", &obj.position.x, 0.1f);
-                        ImGui::DragFloat3("Rotation", &obj.rotation.x, 0.5f);
-                        ImGui::DragFloat3("Scale",    &obj.scale.x,    0.1f);
-                        ImGui::TreePop();
-                    }
-                    ImGui::PopID();
-                }
-            }
-            ImGui::End();
+            outliner.draw(scene);
 
             if (ImGui::Begin("Camera")) {
                 ImGui::SliderFloat3("Position", &camera.position[0], -50.0f, 50.0f);
@@ -95,11 +185,21 @@ int main() {
             }
             ImGui::End();
 
+            DrawMemoryPanel(renderer.memory(), now, /*sampleRss=*/!bench);
             DrawAxesOverlay(camera);
             imgui.end(renderer.currentCommandBuffer());
             renderer.endFrame();
+
+            if (bench) {
+                double frameMs = toMs(Clock::now() - frameStart);
+                bench->record(frameMs, frameMs - waitMs);
+                if (bench->done()) break;
+            }
         }
         renderer.waitIdle();
+        double gpuMs = 0.0;
+        if (bench && renderer.takeGpuFrameMs(gpuMs)) bench->recordGpu(gpuMs);
+        if (bench) bench->writeReport(scene.objects().size(), config.headless, renderer.memory());
     } catch (const std::exception& e) {
         spdlog::error("Fatal: {}", e.what());
         return EXIT_FAILURE;